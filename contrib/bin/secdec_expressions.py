@@ -0,0 +1,267 @@
+"""
+Value numbering of the expressions that FORM writes into the
+generated integrands, shared by optimize_info and the export scripts
+in this directory.
+
+Every expression is parsed and brought into a canonical form: a sum
+of monomials with rational coefficients, each monomial a product of
+atoms (the values of identifiers, of calls and of sums that are not
+expanded) with integer exponents. The canonical form folds numerical
+constants, drops zero terms and unit factors, and does not depend on
+the order of terms and factors or on where a sign is written, so that
+"-b*a", "a*(-b)" and "-(a*b)", or "pow(x,2)" and "SecDecInternalSqr(x)",
+get the same value number. An identifier stands for the value number
+of what it holds at that point, so that temporaries that only copy
+each other, and everything computed from them, are recognized as
+well. A statement whose value an earlier temporary still holds is
+redundant: the rewriting functions of this module replace it by a
+copy of that temporary or drop it.
+
+The canonical form is only used to compare values: the rewriting
+functions never write it back, so statements that are not redundant
+keep the expression FORM wrote. Emitting folded constants, simplified
+expressions or reduced strength is out of scope for this module.
+export_sector already writes every "pow(x,n)" as a product of
+squares, such as "SecDecInternalSqr(x1)*x1" for "pow(x1,3)", and
+GCC folds the constants and turns a multiplication by 2 into an
+addition, or fuses a multiplication by a small constant with the
+addition that follows it into one fused multiply-add, which rewriting
+it as additions here would prevent.
+
+"operations" counts the floating point operations of an expression:
+one per binary addition, subtraction, multiplication or division,
+exponent minus one per power, none for the real and imaginary parts.
+"""
+
+from fractions import Fraction
+import re
+
+re_token = re.compile(r'\s*(?:(\d+(?:\.\d*)?(?:[eE][-+]?\d+)?)|([A-Za-z_]\w*(?:\[\d+\])?)|(\S))')
+
+# calls that cost one operation each; the others cost none
+COSTLY_CALLS = frozenset(["SecDecInternalDenominator", "SecDecInternalAbs"])
+SQUARE_CALLS = frozenset(["SecDecInternalSqr"])
+
+
+def tokenize(text):
+    tokens = []
+    for m in re_token.finditer(text):
+        if m.group(1):
+            tokens.append(("num", m.group(1)))
+        elif m.group(2):
+            tokens.append(("id", m.group(2)))
+        elif m.group(3):
+            tokens.append(("op", m.group(3)))
+    return tokens
+
+
+class Parser(object):
+    """
+    Recursive descent over the tokens of one expression. The trees are
+    tuples: ("num", Fraction), ("sym", name), ("neg", e), ("add", terms),
+    ("mul", factors), ("pow", base, exponent) and ("call", name, args).
+    """
+
+    def __init__(self, text):
+        self.tokens = tokenize(text)
+        self.i = 0
+
+    def peek(self):
+        return self.tokens[self.i] if self.i < len(self.tokens) else (None, None)
+
+    def take(self, expected=None):
+        token = self.peek()
+        if token[0] is None or (expected is not None and token != expected):
+            raise ValueError("unexpected %r, expected %r" % (token[1], expected and expected[1]))
+        self.i += 1
+        return token
+
+    def expression(self):
+        terms = [self.signed_term()]
+        while self.peek() in (("op", "+"), ("op", "-")):
+            terms.append(self.signed_term())
+        return terms[0] if len(terms) == 1 else ("add", tuple(terms))
+
+    def signed_term(self):
+        sign = 1
+        while self.peek() in (("op", "+"), ("op", "-")):
+            if self.take()[1] == "-":
+                sign = -sign
+        term = self.term()
+        return ("neg", term) if sign < 0 else term
+
+    def term(self):
+        factors = [self.factor()]
+        while self.peek() in (("op", "*"), ("op", "/")):
+            if self.take()[1] == "/":
+                factors.append(("pow", self.factor(), -1))
+            else:
+                factors.append(self.factor())
+        return factors[0] if len(factors) == 1 else ("mul", tuple(factors))
+
+    def factor(self):
+        if self.peek() == ("op", "-"):
+            self.take()
+            return ("neg", self.factor())
+        kind, value = self.take()
+        if kind == "num":
+            return ("num", Fraction(value))
+        if kind == "op":
+            if value != "(":
+                raise ValueError("unexpected %r" % value)
+            inner = self.expression()
+            self.take(("op", ")"))
+            return inner
+        if self.peek() != ("op", "("):
+            return ("sym", value)
+        self.take()
+        args = [self.expression()]
+        while self.peek() == ("op", ","):
+            self.take()
+            args.append(self.expression())
+        self.take(("op", ")"))
+        if value == "pow" and len(args) == 2 and args[1][0] == "num" and args[1][1].denominator == 1:
+            return ("pow", args[0], int(args[1][1]))
+        if value in SQUARE_CALLS and len(args) == 1:
+            return ("pow", args[0], 2)
+        return ("call", value, tuple(args))
+
+
+def parse(text):
+    parser = Parser(text)
+    tree = parser.expression()
+    if parser.peek()[0] is not None:
+        raise ValueError("trailing %r in %r" % (parser.peek()[1], text))
+    return tree
+
+
+def operations(tree):
+    """The floating point operations of "tree" (see the module doc)."""
+    kind = tree[0]
+    if kind in ("num", "sym"):
+        return 0
+    if kind == "neg":
+        return operations(tree[1]) + (0 if tree[1][0] == "num" else 1)
+    if kind in ("add", "mul"):
+        # a negated term or factor is a subtraction or a sign, not an extra operation
+        count = len(tree[1]) - 1
+        for operand in tree[1]:
+            count += operations(operand[1] if operand[0] == "neg" else operand)
+        return count
+    if kind == "pow":
+        return operations(tree[1]) + max(abs(tree[2]) - 1, 0) + (1 if tree[2] < 0 else 0)
+    return sum(operations(arg) for arg in tree[2]) + (1 if tree[1] in COSTLY_CALLS else 0)
+
+
+class ValueNumbers(object):
+    """
+    The value numbers of one body: "names" maps every identifier that
+    has been assigned to the value number it currently holds;
+    identifiers that are never assigned, such as the integration
+    variables, are values of their own. Bodies that share "table"
+    give equal values the same number.
+    """
+
+    def __init__(self, table=None):
+        self.table = {} if table is None else table
+        self.names = {}
+
+    def intern(self, form):
+        return self.table.setdefault(form, len(self.table))
+
+    def of(self, tree):
+        """The value number of the expression "tree"."""
+        return self.of_polynomial(self.polynomial(tree))
+
+    def of_polynomial(self, polynomial):
+        items = [(monomial, coefficient) for monomial, coefficient in polynomial.items() if coefficient != 0]
+        if len(items) == 1 and items[0][1] == 1 and len(items[0][0]) == 1 and items[0][0][0][1] == 1:
+            return items[0][0][0][0]
+        return self.intern(("sum", tuple(sorted(items))))
+
+    def atom(self, number):
+        return {((number, 1),): Fraction(1)}
+
+    def polynomial(self, tree):
+        """
+        "tree" as {monomial: coefficient}, with the monomials sorted
+        tuples of (value number of an atom, exponent).
+        """
+        kind = tree[0]
+        if kind == "num":
+            return {(): tree[1]}
+        if kind == "sym":
+            number = self.names.get(tree[1])
+            if number is None:
+                number = self.intern(("symbol", tree[1]))
+            return self.atom(number)
+        if kind == "neg":
+            return dict((m, -c) for m, c in self.polynomial(tree[1]).items())
+        if kind == "add":
+            result = {}
+            for term in tree[1]:
+                for monomial, coefficient in self.polynomial(term).items():
+                    result[monomial] = result.get(monomial, 0) + coefficient
+            return dict((m, c) for m, c in result.items() if c != 0) or {(): Fraction(0)}
+        if kind == "mul":
+            coefficient = Fraction(1)
+            exponents = {}
+            for factor in tree[1]:
+                polynomial = self.polynomial(factor)
+                if len(polynomial) == 1:
+                    (monomial, c), = polynomial.items()
+                else:
+                    monomial, c = ((self.of_polynomial(polynomial), 1),), 1
+                coefficient *= c
+                for number, exponent in monomial:
+                    exponents[number] = exponents.get(number, 0) + exponent
+            if coefficient == 0:
+                return {(): Fraction(0)}
+            return {tuple(sorted((n, e) for n, e in exponents.items() if e != 0)): coefficient}
+        if kind == "pow":
+            polynomial = self.polynomial(tree[1])
+            if len(polynomial) == 1:
+                (monomial, c), = polynomial.items()
+                if c != 0 or tree[2] > 0:
+                    return {tuple((n, e*tree[2]) for n, e in monomial): c**tree[2]}
+            return {((self.of_polynomial(polynomial), tree[2]),): Fraction(1)}
+        return self.atom(self.intern(("call", tree[1], tuple(self.of(arg) for arg in tree[2]))))
+
+
+def rename(line, aliases):
+    if not aliases:
+        return line
+    return re.sub(r'\b[A-Za-z_]\w*\b', lambda m: aliases.get(m.group(0), m.group(0)), line)
+
+
+def drop_duplicates(lines, re_statement):
+    """
+    Drop the temporaries of the body "lines", in which every temporary
+    is assigned once (matches of "re_statement", whose groups are its
+    name and expression), that compute the value of an earlier one,
+    and use that one in their place. Returns the new lines and the
+    operations of the temporaries before and after.
+    """
+    numbers = ValueNumbers()
+    holders = {}
+    aliases = {}
+    out = []
+    before = after = 0
+    for line in lines:
+        line = rename(line, aliases)
+        m = re_statement.match(line)
+        if m is None:
+            out.append(line)
+            continue
+        tree = parse(m.group(2))
+        cost = operations(tree)
+        before += cost
+        number = numbers.of(tree)
+        numbers.names[m.group(1)] = number
+        if number in holders:
+            aliases[m.group(1)] = holders[number]
+            continue
+        holders[number] = m.group(1)
+        after += cost
+        out.append(line)
+    return out, before, after
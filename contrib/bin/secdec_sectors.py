@@ -0,0 +1,28 @@
+"""
+The files that pySecDec generates for a sector of a package.
+
+"codegen/sector<n>.d", which pySecDec writes with the package, lists
+the sources that "codegen/sector<n>.done" produces; contrib/bin/autotune
+and contrib/bin/codegen_cache replace them as a whole.
+"""
+
+import re
+
+re_variable = re.compile(r'^(SECTOR\d+_(?:CPP|DISTSRC))\s*=\s*((?:.*\\\n)*.*)$', re.M)
+
+
+def sector_files(sector):
+    """
+    The generated files of "sector", as listed in "codegen/sector<n>.d",
+    with the headers of the sources in "src/" and the FORM output
+    "codegen/sector<n>.info" that they are exported from.
+    """
+    with open("codegen/sector%s.d" % sector) as f:
+        text = f.read()
+    files = ["codegen/sector%s.info" % sector]
+    for m in re_variable.finditer(text):
+        for filename in m.group(2).replace("\\\n", " ").split():
+            files.append(filename)
+            if m.group(1).endswith("_CPP"):
+                files.append(filename[:-len(".cpp")] + ".hpp")
+    return files
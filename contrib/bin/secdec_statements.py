@@ -0,0 +1,269 @@
+"""
+Dependency analysis of the statements that FORM writes into the
+generated integrands, shared by the scripts in this directory.
+
+Every temporary "auto tmp = <expression>;" is classified by what it
+eventually depends on: the integration variables, the real or complex
+parameters, and the deformation parameters. A temporary that depends
+on none of the integration variables is the same for every point of
+one call, and can be computed once, before the points are visited.
+
+FORM writes the temporaries in the order it abbreviated them, so many
+are computed hundreds of lines before their first use; "schedule"
+moves every temporary next to the line that first needs it, and
+"peak_live" estimates how many vector registers the result needs.
+"""
+
+import re
+
+# dependency tags
+VARIABLES = "x"
+PARAMETERS = "parameters"
+DEFORMATION = "deformation"
+
+re_identifier = re.compile(r'\b[A-Za-z_]\w*\b')
+
+# identifiers of the imaginary unit in the generated expressions
+COMPLEX_UNITS = frozenset(["SecDecInternalI", "i_"])
+
+
+class Statement(object):
+    """
+    One "auto <name> = <expression>;" line, or any other line of a
+    body (name None), with the tags of what it depends on.
+    """
+
+    def __init__(self, line, name, expression):
+        self.line = line
+        self.name = name
+        self.expression = expression
+        self.tags = frozenset()
+
+    @property
+    def invariant(self):
+        return self.name is not None and VARIABLES not in self.tags
+
+
+def classify(lines, re_statement, seeds):
+    """
+    Parse the body "lines" with "re_statement", whose groups are the
+    name and the expression of a temporary, and tag every statement
+    with the tags of the identifiers it uses: "seeds" maps the
+    identifiers defined outside of the body to their tags; other
+    identifiers outside of the body, such as functions, have none.
+    """
+    tags = dict(seeds)
+    statements = []
+    for line in lines:
+        m = re_statement.match(line)
+        if m:
+            statement = Statement(line, m.group(1), m.group(2))
+        else:
+            statement = Statement(line, None, line)
+        used = set()
+        for identifier in re_identifier.findall(statement.expression):
+            used |= tags.get(identifier, frozenset())
+        statement.tags = frozenset(used)
+        if statement.name is not None:
+            tags[statement.name] = statement.tags
+        statements.append(statement)
+    return statements
+
+
+def hoist(lines, re_statement, seeds):
+    """
+    Split the body "lines" into the temporaries that do not depend on
+    the integration variables and everything else, each in its
+    original order; the first part can be evaluated ahead of the
+    second.
+    """
+    statements = classify(lines, re_statement, seeds)
+    invariant = [s.line for s in statements if s.invariant]
+    rest = [s.line for s in statements if not s.invariant]
+    return invariant, rest
+
+
+
+def wraps(expression, function):
+    """Whether "expression" is one call of "function" as a whole."""
+    if not expression.startswith(function + "(") or not expression.endswith(")"):
+        return False
+    depth = 0
+    for k in range(len(function), len(expression)):
+        depth += {"(": 1, ")": -1}.get(expression[k], 0)
+        if depth == 0:
+            return k == len(expression) - 1
+    return False
+
+
+def widths(statements, seeds):
+    """
+    The number of real vectors that the value of every temporary in
+    "statements" (see classify) takes: 2 for complex values, 1 for
+    real ones. "seeds" maps the complex identifiers defined outside
+    of the body to 2; the imaginary unit makes a value complex, real
+    and imaginary parts make it real.
+    """
+    width = dict(seeds)
+    for statement in statements:
+        if statement.name is None:
+            continue
+        if wraps(statement.expression, "SecDecInternalRealPart") or \
+                wraps(statement.expression, "SecDecInternalImagPart"):
+            width[statement.name] = 1
+            continue
+        complex_value = False
+        for identifier in re_identifier.findall(statement.expression):
+            if identifier in COMPLEX_UNITS or width.get(identifier, 1) == 2:
+                complex_value = True
+                break
+        width[statement.name] = 2 if complex_value else 1
+    return width
+
+
+def peak_live(statements, width, inputs=()):
+    """
+    The largest number of real vectors that are live at once when
+    "statements" are evaluated in their order: every temporary from
+    its definition to its last use, and the identifiers "inputs",
+    defined before the body, from its start to their last use. The
+    temporaries count as given by "width" (see widths).
+    """
+    last_use = {}
+    for k, statement in enumerate(statements):
+        for identifier in re_identifier.findall(statement.expression):
+            last_use[identifier] = k
+    alive = set(name for name in inputs if name in last_use)
+    live = sum(width.get(name, 1) for name in alive)
+    peak = live
+    for k, statement in enumerate(statements):
+        if statement.name is not None:
+            live += width.get(statement.name, 1)
+            peak = max(peak, live)
+            if statement.name in last_use:
+                alive.add(statement.name)
+            else:
+                live -= width.get(statement.name, 1)
+        for identifier in set(re_identifier.findall(statement.expression)):
+            if identifier in alive and last_use[identifier] == k:
+                alive.remove(identifier)
+                live -= width.get(identifier, 1)
+    return peak
+
+
+def operands(statements):
+    """
+    For every statement of "statements", the indices of the earlier
+    temporaries that it uses.
+    """
+    index = {}
+    result = []
+    for statement in statements:
+        found = []
+        for identifier in re_identifier.findall(statement.expression):
+            j = index.get(identifier)
+            if j is not None and j not in found:
+                found.append(j)
+        result.append(found)
+        if statement.name is not None:
+            index[statement.name] = len(result) - 1
+    return result
+
+
+def demand_order(statements, width, uses):
+    """
+    The order in which the lines that are not temporaries, and the
+    temporaries that nothing uses, are kept as they are, and every
+    other temporary is computed when the first of these needs it,
+    after its own operands, the operand that needs the most vectors
+    (its Sethi-Ullman number) first.
+    """
+    used = set(j for found in uses for j in found)
+    need = []
+    children = []
+    for k, statement in enumerate(statements):
+        labels = sorted((need[j] for j in uses[k]), reverse=True)
+        own = width.get(statement.name, 1) if statement.name is not None else 0
+        need.append(max([own] + [label + n for n, label in enumerate(labels)]))
+        children.append(sorted(uses[k], key=lambda j: (-need[j], j)))
+    order = []
+    done = [False] * len(statements)
+    for root, statement in enumerate(statements):
+        if done[root] or (statement.name is not None and root in used):
+            continue
+        stack = [(root, 0)]
+        while stack:
+            k, n = stack.pop()
+            while n < len(children[k]) and done[children[k][n]]:
+                n += 1
+            if n < len(children[k]):
+                stack.append((k, n + 1))
+                stack.append((children[k][n], 0))
+            elif not done[k]:
+                done[k] = True
+                order.append(k)
+    return order
+
+
+def greedy_order(statements, width, uses):
+    """
+    The order that a bottom-up list scheduler picks: going backwards
+    from the end of the body, it places next the statement, among
+    those whose users are all placed, that makes the fewest vectors
+    live (operands that were not live yet, less its own value), the
+    one that came later in the original order on ties. The lines
+    that are not temporaries keep their order.
+    """
+    pending = [0] * len(statements)
+    for found in uses:
+        for j in found:
+            pending[j] += 1
+    lines = [k for k, statement in enumerate(statements) if statement.name is None]
+    previous_line = dict(zip(lines[1:], lines))
+    for k in previous_line.values():
+        pending[k] += 1
+
+    def size(k):
+        return width.get(statements[k].name, 1) if statements[k].name is not None else 0
+
+    ready = set(k for k in range(len(statements)) if pending[k] == 0)
+    live = set()
+    order = []
+    while ready:
+        k = min(ready, key=lambda k: (sum(size(j) for j in uses[k] if j not in live) -
+                                      (size(k) if k in live else 0), -k))
+        ready.remove(k)
+        live.discard(k)
+        order.append(k)
+        for j in uses[k] + ([previous_line[k]] if k in previous_line else []):
+            if j in uses[k]:
+                live.add(j)
+            pending[j] -= 1
+            if pending[j] == 0:
+                ready.add(j)
+    order.reverse()
+    return order
+
+
+def schedule(statements, width, inputs=()):
+    """
+    Reorder the body "statements" (see classify) to shorten the live
+    ranges of its temporaries, which FORM writes in the order it
+    abbreviated them: of the original order, demand_order and
+    greedy_order, returns the one with the lowest peak_live. The lines
+    that are not temporaries, such as sign checks, keep their order;
+    a body with lines that are not single statements, such as blocks,
+    is returned as it is.
+    """
+    statements = list(statements)
+    if any(s.name is None and not s.line.rstrip().endswith(";") for s in statements):
+        return statements
+    uses = operands(statements)
+    best = statements
+    peak = peak_live(best, width, inputs)
+    for order in (demand_order(statements, width, uses), greedy_order(statements, width, uses)):
+        candidate = [statements[k] for k in order]
+        candidate_peak = peak_live(candidate, width, inputs)
+        if candidate_peak < peak:
+            best, peak = candidate, candidate_peak
+    return best
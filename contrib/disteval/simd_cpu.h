@@ -0,0 +1,1096 @@
+#ifndef SECDEC_SIMD_CPU_H
+#define SECDEC_SIMD_CPU_H
+
+/*
+ * Vector types and helpers for the disteval CPU kernels.
+ *
+ * This is a drop-in replacement for pySecDec's "common_cpu.h"
+ * with the number of lanes of "realvec_t" chosen at compile time
+ * through REALVEC_SIZE instead of being fixed to 4. The same kernel
+ * source is compiled once per instruction set (see the DIST_ISAS
+ * variable in the integral Makefile); SECDEC_ISA names that build
+ * and is appended to every exported kernel symbol, so that all
+ * widths can live side by side in one shared library. The
+ * unsuffixed symbols are provided by "simd_dispatch.h".
+ *
+ * Unlike in "common_cpu.h", "complexvec_t" is a pair of real
+ * vectors (all real parts, then all imaginary parts) rather than an
+ * array of complex numbers; the generated code only ever goes
+ * through the operators and accessors below, so it is unaffected.
+ *
+ * With SECDEC_SINGLE, the lanes of the vectors hold single-precision
+ * numbers ("lane_t"), twice as many per register, while the kernel
+ * interface, the scalars, the lattice coordinates and the sums stay
+ * in double precision. Only the plain integrand kernels are built
+ * this way, as "<kernel>__single" (see SECDEC_SINGLE_ISA_NAME); the
+ * "__guarded" kernels of the double-precision builds use them where
+ * single precision is good enough (see precision_guarded).
+ *
+ * With SECDEC_DD, every lane holds a double-double number ("ddvec_t":
+ * an unevaluated sum of two doubles, about 32 significant digits).
+ * Only "<kernel>__point" is built this way, as "<kernel>__point__dd"
+ * (see SECDEC_DD_ISA_NAME); the "__refined" kernels of the double
+ * builds call it for the points where the integrand loses too many
+ * digits to cancellation (see cancelled_lanes). It needs exact
+ * floating-point semantics: the Makefile builds it without
+ * -funsafe-math-optimizations.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define restrict __restrict__
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+#ifndef REALVEC_SIZE
+    #define REALVEC_SIZE 4
+#endif
+
+/* Point vectors generated at a time by the block-wise kernels (all
+ * sectors fused, several shifts), which then evaluate the integrand
+ * several times on them; sized to stay within L1. */
+#ifndef SECDEC_FUSED_BLOCK
+    #define SECDEC_FUSED_BLOCK 16
+#endif
+
+/* Point vectors summed into the plain accumulator of a kernel before
+ * it is handed to the pairwise sum (see pairwise_sum_t). */
+#ifndef SECDEC_SUM_BLOCK
+    #define SECDEC_SUM_BLOCK 64
+#endif
+
+/* Shifts or kinematic points that the batched kernels evaluate in one
+ * pass over the lattice, each with its own pairwise sum; more of them
+ * take several passes. */
+#ifndef SECDEC_BATCH_SIZE
+    #define SECDEC_BATCH_SIZE 8
+#endif
+
+#define SECDEC_CONCAT_(a, b) a ## b
+#define SECDEC_CONCAT(a, b) SECDEC_CONCAT_(a, b)
+#ifdef SECDEC_ISA
+    #define SECDEC_DOUBLE_ISA_NAME(name) SECDEC_CONCAT(name, SECDEC_CONCAT(__, SECDEC_ISA))
+    #define SECDEC_SINGLE_ISA_NAME(name) SECDEC_CONCAT(name, SECDEC_CONCAT(__single__, SECDEC_ISA))
+    #define SECDEC_DD_ISA_NAME(name) SECDEC_CONCAT(name, SECDEC_CONCAT(__dd__, SECDEC_ISA))
+#else
+    #define SECDEC_DOUBLE_ISA_NAME(name) name
+    #define SECDEC_SINGLE_ISA_NAME(name) SECDEC_CONCAT(name, __single)
+    #define SECDEC_DD_ISA_NAME(name) SECDEC_CONCAT(name, __dd)
+#endif
+#ifdef SECDEC_SINGLE
+    #define SECDEC_ISA_NAME(name) SECDEC_SINGLE_ISA_NAME(name)
+#elif defined(SECDEC_DD)
+    #define SECDEC_ISA_NAME(name) SECDEC_DD_ISA_NAME(name)
+#else
+    #define SECDEC_ISA_NAME(name) SECDEC_DOUBLE_ISA_NAME(name)
+#endif
+
+/* Lattice points checked in both precisions by precision_guarded. */
+#ifndef SECDEC_GUARD_POINTS
+    #define SECDEC_GUARD_POINTS 1024
+#endif
+
+typedef double real_t;
+typedef int64_t int_t;
+#ifdef SECDEC_SINGLE
+    typedef float lane_t;
+#else
+    typedef double lane_t;
+#endif
+
+struct complex_t {
+    real_t re, im;
+    complex_t &operator =(const real_t x) { re = x; im = 0; return *this; }
+};
+
+#ifdef SECDEC_DD
+
+/*
+ * Double-double vectors: lane k holds hi[k] + lo[k] with |lo[k]| at
+ * most half an ulp of hi[k]. The sums and products are the usual
+ * error-free transformations (two_sum, two_prod with a fused
+ * multiply-add), the quotient takes one correction step. Lanes are
+ * read as their rounded value, "x[k]"; comparisons look at the sign
+ * of the difference, whose high part decides it.
+ */
+typedef real_t ddvec_part_t __attribute__((vector_size(REALVEC_SIZE*sizeof(real_t))));
+typedef int_t ddvec_mask_native_t __attribute__((vector_size(REALVEC_SIZE*sizeof(int_t))));
+
+/* Lanewise comparison results, wrapped like the vectors themselves:
+ * GCC warns about the ABI of functions that return a bare vector
+ * wider than a register, as in the generic build. */
+struct ddvec_mask_t {
+    ddvec_mask_native_t m;
+    int_t operator [](const int k) const { return m[k]; }
+};
+
+struct ddvec_t {
+    ddvec_part_t hi, lo;
+    real_t operator [](const int k) const { return hi[k] + lo[k]; }
+};
+
+static inline ddvec_t
+dd_fast_two_sum(const ddvec_part_t &a, const ddvec_part_t &b)
+{
+    const ddvec_part_t s = a + b;
+    return ddvec_t{s, b - (s - a)};
+}
+
+static inline ddvec_t
+dd_two_sum(const ddvec_part_t &a, const ddvec_part_t &b)
+{
+    const ddvec_part_t s = a + b;
+    const ddvec_part_t bb = s - a;
+    return ddvec_t{s, (a - (s - bb)) + (b - bb)};
+}
+
+static inline ddvec_t
+dd_two_prod(const ddvec_part_t &a, const ddvec_part_t &b)
+{
+    const ddvec_part_t p = a*b;
+    ddvec_part_t e;
+    for (int k = 0; k < REALVEC_SIZE; k++) e[k] = __builtin_fma(a[k], b[k], -p[k]);
+    return ddvec_t{p, e};
+}
+
+static inline ddvec_t dd_from(const real_t a) { return ddvec_t{(ddvec_part_t){} + a, (ddvec_part_t){}}; }
+
+static inline ddvec_t operator -(const ddvec_t &a) { return ddvec_t{-a.hi, -a.lo}; }
+
+static inline ddvec_t
+operator +(const ddvec_t &a, const ddvec_t &b)
+{
+    ddvec_t s = dd_two_sum(a.hi, b.hi);
+    const ddvec_t t = dd_two_sum(a.lo, b.lo);
+    s = dd_fast_two_sum(s.hi, s.lo + t.hi);
+    return dd_fast_two_sum(s.hi, s.lo + t.lo);
+}
+
+static inline ddvec_t
+operator +(const ddvec_t &a, const real_t b)
+{
+    const ddvec_t s = dd_two_sum(a.hi, (ddvec_part_t){} + b);
+    return dd_fast_two_sum(s.hi, s.lo + a.lo);
+}
+
+static inline ddvec_t operator +(const real_t a, const ddvec_t &b) { return b + a; }
+static inline ddvec_t operator -(const ddvec_t &a, const ddvec_t &b) { return a + -b; }
+static inline ddvec_t operator -(const ddvec_t &a, const real_t b) { return a + -b; }
+static inline ddvec_t operator -(const real_t a, const ddvec_t &b) { return -b + a; }
+
+static inline ddvec_t
+operator *(const ddvec_t &a, const ddvec_t &b)
+{
+    const ddvec_t p = dd_two_prod(a.hi, b.hi);
+    return dd_fast_two_sum(p.hi, p.lo + (a.hi*b.lo + a.lo*b.hi));
+}
+
+static inline ddvec_t
+operator *(const ddvec_t &a, const real_t b)
+{
+    const ddvec_t p = dd_two_prod(a.hi, (ddvec_part_t){} + b);
+    return dd_fast_two_sum(p.hi, p.lo + a.lo*b);
+}
+
+static inline ddvec_t operator *(const real_t a, const ddvec_t &b) { return b*a; }
+
+static inline ddvec_t
+operator /(const ddvec_t &a, const ddvec_t &b)
+{
+    const ddvec_part_t q1 = a.hi/b.hi;
+    const ddvec_t r = a - b*ddvec_t{q1, (ddvec_part_t){}};
+    return dd_fast_two_sum(q1, r.hi/b.hi);
+}
+
+static inline ddvec_t operator /(const ddvec_t &a, const real_t b) { return a/dd_from(b); }
+static inline ddvec_t operator /(const real_t a, const ddvec_t &b) { return dd_from(a)/b; }
+
+#define SECDEC_DD_CMP(op) \
+    static inline ddvec_mask_t operator op(const ddvec_t &a, const ddvec_t &b) { return ddvec_mask_t{(a - b).hi op 0}; } \
+    static inline ddvec_mask_t operator op(const ddvec_t &a, const real_t b) { return ddvec_mask_t{(a - b).hi op 0}; }
+
+SECDEC_DD_CMP(<)
+SECDEC_DD_CMP(<=)
+SECDEC_DD_CMP(>)
+SECDEC_DD_CMP(>=)
+
+#undef SECDEC_DD_CMP
+
+static inline ddvec_t
+vec_select(const ddvec_mask_t &m, const ddvec_t &a, const ddvec_t &b)
+{
+    return ddvec_t{m.m ? a.hi : b.hi, m.m ? a.lo : b.lo};
+}
+
+typedef ddvec_t realvec_native_t;
+
+#else
+
+/* GCC/Clang vector extensions: the lanes are still addressed as
+ * "x.x[k]", but whole-vector arithmetic maps onto SIMD registers. */
+typedef lane_t realvec_native_t __attribute__((vector_size(REALVEC_SIZE*sizeof(lane_t))));
+
+/* Lanewise "m ? a : b"; a macro, since a function returning a vector
+ * wider than a register, as in the SECDEC_DISPATCH build, makes GCC
+ * warn about its ABI. */
+#define vec_select(m, a, b) ((m) ? (a) : (b))
+
+#endif
+
+struct realvec_t { realvec_native_t x; };
+struct complexvec_t { realvec_native_t re, im; };
+
+#define REAL_NAN (real_t)NAN
+#define REALVEC_CONST(c) realvec_const(c)
+
+static const complex_t i_ = {0, 1};
+
+static inline realvec_t
+realvec_const(const real_t c)
+{
+    return realvec_t{(lane_t)c - (realvec_native_t){}};
+}
+
+/* Scalar complex arithmetic */
+
+static inline complex_t operator -(const complex_t a) { return complex_t{-a.re, -a.im}; }
+
+static inline complex_t operator +(const complex_t a, const complex_t b) { return complex_t{a.re + b.re, a.im + b.im}; }
+static inline complex_t operator +(const complex_t a, const real_t b) { return complex_t{a.re + b, a.im}; }
+static inline complex_t operator +(const real_t a, const complex_t b) { return complex_t{a + b.re, b.im}; }
+
+static inline complex_t operator -(const complex_t a, const complex_t b) { return complex_t{a.re - b.re, a.im - b.im}; }
+static inline complex_t operator -(const complex_t a, const real_t b) { return complex_t{a.re - b, a.im}; }
+static inline complex_t operator -(const real_t a, const complex_t b) { return complex_t{a - b.re, -b.im}; }
+
+static inline complex_t operator *(const complex_t a, const complex_t b) { return complex_t{a.re*b.re - a.im*b.im, a.re*b.im + a.im*b.re}; }
+static inline complex_t operator *(const complex_t a, const real_t b) { return complex_t{a.re*b, a.im*b}; }
+static inline complex_t operator *(const real_t a, const complex_t b) { return complex_t{a*b.re, a*b.im}; }
+
+static inline complex_t operator /(const complex_t a, const complex_t b)
+{
+    real_t inv = 1/(b.re*b.re + b.im*b.im);
+    return complex_t{(a.re*b.re + a.im*b.im)*inv, (a.im*b.re - a.re*b.im)*inv};
+}
+static inline complex_t operator /(const complex_t a, const real_t b) { return complex_t{a.re/b, a.im/b}; }
+static inline complex_t operator /(const real_t a, const complex_t b)
+{
+    real_t inv = a/(b.re*b.re + b.im*b.im);
+    return complex_t{b.re*inv, -b.im*inv};
+}
+
+/* Real vector arithmetic */
+
+#define SECDEC_REALVEC_BINOP(op) \
+    static inline realvec_t operator op(const realvec_t &a, const realvec_t &b) { return realvec_t{a.x op b.x}; } \
+    static inline realvec_t operator op(const realvec_t &a, const real_t b) { return realvec_t{a.x op (lane_t)b}; } \
+    static inline realvec_t operator op(const real_t a, const realvec_t &b) { return realvec_t{(lane_t)a op b.x}; }
+
+SECDEC_REALVEC_BINOP(+)
+SECDEC_REALVEC_BINOP(-)
+SECDEC_REALVEC_BINOP(*)
+SECDEC_REALVEC_BINOP(/)
+
+#undef SECDEC_REALVEC_BINOP
+
+static inline realvec_t operator -(const realvec_t &a) { return realvec_t{-a.x}; }
+
+/*
+ * Complex vector arithmetic. The real and imaginary parts are kept
+ * in separate vectors, so every operation is plain lane-parallel
+ * arithmetic without shuffles. Below, "R" is either real operand
+ * (real_t or realvec_t), whose value is taken with rv().
+ */
+
+static inline lane_t rv(const real_t a) { return a; }
+static inline const realvec_native_t &rv(const realvec_t &a) { return a.x; }
+
+static inline complexvec_t operator -(const complexvec_t &a) { return complexvec_t{-a.re, -a.im}; }
+
+#define SECDEC_COMPLEXVEC_REAL_OPS(R) \
+    static inline complexvec_t operator +(const complexvec_t &a, const R &b) { return complexvec_t{a.re + rv(b), a.im}; } \
+    static inline complexvec_t operator +(const R &a, const complexvec_t &b) { return complexvec_t{rv(a) + b.re, b.im}; } \
+    static inline complexvec_t operator -(const complexvec_t &a, const R &b) { return complexvec_t{a.re - rv(b), a.im}; } \
+    static inline complexvec_t operator -(const R &a, const complexvec_t &b) { return complexvec_t{rv(a) - b.re, -b.im}; } \
+    static inline complexvec_t operator *(const complexvec_t &a, const R &b) { return complexvec_t{a.re*rv(b), a.im*rv(b)}; } \
+    static inline complexvec_t operator *(const R &a, const complexvec_t &b) { return complexvec_t{rv(a)*b.re, rv(a)*b.im}; } \
+    static inline complexvec_t operator /(const complexvec_t &a, const R &b) { return complexvec_t{a.re/rv(b), a.im/rv(b)}; } \
+    static inline complexvec_t operator /(const R &a, const complexvec_t &b) \
+    { \
+        realvec_native_t inv = rv(a)/(b.re*b.re + b.im*b.im); \
+        return complexvec_t{b.re*inv, -b.im*inv}; \
+    }
+
+SECDEC_COMPLEXVEC_REAL_OPS(real_t)
+SECDEC_COMPLEXVEC_REAL_OPS(realvec_t)
+
+#undef SECDEC_COMPLEXVEC_REAL_OPS
+
+/* Either complex operand, with scalar parts in "lane_t". */
+struct complex_lane_t { lane_t re, im; };
+static inline complex_lane_t cl(const complex_t a) { return complex_lane_t{(lane_t)a.re, (lane_t)a.im}; }
+static inline const complexvec_t &cl(const complexvec_t &a) { return a; }
+
+#define SECDEC_COMPLEXVEC_COMPLEX_OPS(A, B) \
+    static inline complexvec_t operator +(const A &a, const B &b) { return complexvec_t{cl(a).re + cl(b).re, cl(a).im + cl(b).im}; } \
+    static inline complexvec_t operator -(const A &a, const B &b) { return complexvec_t{cl(a).re - cl(b).re, cl(a).im - cl(b).im}; } \
+    static inline complexvec_t operator *(const A &a_, const B &b_) \
+    { \
+        const auto &a = cl(a_); const auto &b = cl(b_); \
+        return complexvec_t{a.re*b.re - a.im*b.im, a.re*b.im + a.im*b.re}; \
+    } \
+    static inline complexvec_t operator /(const A &a_, const B &b_) \
+    { \
+        const auto &a = cl(a_); const auto &b = cl(b_); \
+        auto inv = 1/(b.re*b.re + b.im*b.im); \
+        return complexvec_t{(a.re*b.re + a.im*b.im)*inv, (a.im*b.re - a.re*b.im)*inv}; \
+    }
+
+SECDEC_COMPLEXVEC_COMPLEX_OPS(complexvec_t, complexvec_t)
+SECDEC_COMPLEXVEC_COMPLEX_OPS(complexvec_t, complex_t)
+SECDEC_COMPLEXVEC_COMPLEX_OPS(complex_t, complexvec_t)
+
+#undef SECDEC_COMPLEXVEC_COMPLEX_OPS
+
+static inline complexvec_t operator +(const realvec_t &a, const complex_t b) { return complexvec_t{a.x + (lane_t)b.re, realvec_const(b.im).x}; }
+static inline complexvec_t operator +(const complex_t a, const realvec_t &b) { return complexvec_t{(lane_t)a.re + b.x, realvec_const(a.im).x}; }
+static inline complexvec_t operator -(const realvec_t &a, const complex_t b) { return complexvec_t{a.x - (lane_t)b.re, realvec_const(-b.im).x}; }
+static inline complexvec_t operator -(const complex_t a, const realvec_t &b) { return complexvec_t{(lane_t)a.re - b.x, realvec_const(a.im).x}; }
+static inline complexvec_t operator *(const realvec_t &a, const complex_t b) { return complexvec_t{a.x*(lane_t)b.re, a.x*(lane_t)b.im}; }
+static inline complexvec_t operator *(const complex_t a, const realvec_t &b) { return complexvec_t{(lane_t)a.re*b.x, (lane_t)a.im*b.x}; }
+static inline complexvec_t operator /(const realvec_t &a, const complex_t b)
+{
+    real_t inv = 1/(b.re*b.re + b.im*b.im);
+    return complexvec_t{a.x*(lane_t)(b.re*inv), a.x*(lane_t)(-b.im*inv)};
+}
+static inline complexvec_t operator /(const complex_t a, const realvec_t &b) { return complexvec_t{(lane_t)a.re/b.x, (lane_t)a.im/b.x}; }
+
+/* Comparisons hold if they hold in every lane; the sign checks
+ * are written as "!(x <= 0)", which then fires if any lane fails. */
+
+#define SECDEC_VEC_CMP(op) \
+    static inline bool operator op(const realvec_t &a, const real_t b) \
+    { \
+        auto mask = a.x op (lane_t)b; \
+        bool r = true; \
+        for (int k = 0; k < REALVEC_SIZE; k++) r = r & (mask[k] != 0); \
+        return r; \
+    }
+
+SECDEC_VEC_CMP(<)
+SECDEC_VEC_CMP(<=)
+SECDEC_VEC_CMP(>)
+SECDEC_VEC_CMP(>=)
+
+#undef SECDEC_VEC_CMP
+
+/* Functions used by the generated code */
+
+#define SecDecInternalDenominator(x) (1.0/(x))
+
+static inline real_t SecDecInternalRealPart(const real_t a) { return a; }
+static inline real_t SecDecInternalRealPart(const complex_t a) { return a.re; }
+static inline realvec_t SecDecInternalRealPart(const realvec_t &a) { return a; }
+static inline realvec_t
+SecDecInternalRealPart(const complexvec_t &a)
+{
+    return realvec_t{a.re};
+}
+
+static inline real_t SecDecInternalImagPart(const real_t a) { (void)a; return 0; }
+static inline real_t SecDecInternalImagPart(const complex_t a) { return a.im; }
+static inline realvec_t SecDecInternalImagPart(const realvec_t &a) { (void)a; return realvec_const(0); }
+static inline realvec_t
+SecDecInternalImagPart(const complexvec_t &a)
+{
+    return realvec_t{a.im};
+}
+
+static inline complex_t SecDecInternalI(const real_t a) { return complex_t{0, a}; }
+static inline complex_t SecDecInternalI(const complex_t a) { return complex_t{-a.im, a.re}; }
+static inline complexvec_t
+SecDecInternalI(const realvec_t &a)
+{
+    return complexvec_t{realvec_const(0).x, a.x};
+}
+static inline complexvec_t
+SecDecInternalI(const complexvec_t &a)
+{
+    return complexvec_t{-a.im, a.re};
+}
+
+static inline real_t SecDecInternalSqr(const real_t a) { return a*a; }
+static inline complex_t SecDecInternalSqr(const complex_t a) { return a*a; }
+static inline realvec_t SecDecInternalSqr(const realvec_t &a) { return a*a; }
+static inline complexvec_t SecDecInternalSqr(const complexvec_t &a) { return a*a; }
+
+static inline real_t SecDecInternalAbs(const real_t a) { return fabs(a); }
+static inline realvec_t
+SecDecInternalAbs(const realvec_t &a)
+{
+    return realvec_t{vec_select(a.x < 0, -a.x, a.x)};
+}
+
+static inline realvec_t
+vec_min(const realvec_t &a, const realvec_t &b)
+{
+    return realvec_t{vec_select(a.x < b.x, a.x, b.x)};
+}
+
+static inline real_t
+componentmin(const realvec_t &a)
+{
+    real_t r = a.x[0];
+    for (int k = 1; k < REALVEC_SIZE; k++) r = a.x[k] < r ? a.x[k] : r;
+    return r;
+}
+
+static inline real_t
+componentsum(const realvec_t &a)
+{
+    real_t r = 0;
+    for (int k = 0; k < REALVEC_SIZE; k++) r += a.x[k];
+    return r;
+}
+
+static inline complex_t
+componentsum(const complexvec_t &a)
+{
+    return complex_t{componentsum(realvec_t{a.re}), componentsum(realvec_t{a.im})};
+}
+
+/*
+ * The sums of the single-precision builds are kept in double
+ * precision, lane by lane.
+ */
+#ifdef SECDEC_SINGLE
+    /* The double-precision vectors are twice as wide as a register,
+     * which only matters for functions that are not inlined. */
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wpsabi"
+
+    typedef real_t realvec_double_t __attribute__((vector_size(REALVEC_SIZE*sizeof(real_t))));
+
+    struct realaccvec_t { realvec_double_t x; };
+    struct complexaccvec_t { realvec_double_t re, im; };
+
+    #define to_double(a) __builtin_convertvector(a, realvec_double_t)
+
+    static inline realaccvec_t operator +(const realaccvec_t &a, const realaccvec_t &b) { return realaccvec_t{a.x + b.x}; }
+    static inline realaccvec_t operator +(const realaccvec_t &a, const realvec_t &b) { return realaccvec_t{a.x + to_double(b.x)}; }
+    static inline complexaccvec_t operator +(const complexaccvec_t &a, const complexaccvec_t &b) { return complexaccvec_t{a.re + b.re, a.im + b.im}; }
+    static inline complexaccvec_t operator +(const complexaccvec_t &a, const complexvec_t &b) { return complexaccvec_t{a.re + to_double(b.re), a.im + to_double(b.im)}; }
+
+    static inline real_t
+    componentsum(const realaccvec_t &a)
+    {
+        real_t r = 0;
+        for (int k = 0; k < REALVEC_SIZE; k++) r += a.x[k];
+        return r;
+    }
+
+    static inline complex_t
+    componentsum(const complexaccvec_t &a)
+    {
+        return complex_t{componentsum(realaccvec_t{a.re}), componentsum(realaccvec_t{a.im})};
+    }
+
+    #pragma GCC diagnostic pop
+#endif
+
+#if SECDEC_RESULT_IS_COMPLEX
+    typedef complex_t result_t;
+    #ifdef SECDEC_SINGLE
+        typedef complexaccvec_t resultvec_t;
+    #else
+        typedef complexvec_t resultvec_t;
+    #endif
+#else
+    typedef real_t result_t;
+    #ifdef SECDEC_SINGLE
+        typedef realaccvec_t resultvec_t;
+    #else
+        typedef realvec_t resultvec_t;
+    #endif
+#endif
+#define RESULTVEC_ZERO resultvec_t{}
+
+/*
+ * Blocked pairwise summation. The kernels add SECDEC_SUM_BLOCK point
+ * vectors into their accumulator "acc" as before and then push it
+ * into a binary tree of partial sums, so that the rounding error of a
+ * call grows with the block length and the logarithm of the number
+ * of blocks rather than with the number of points, and one call can
+ * cover a whole lattice. Unlike Kahan summation this does not rely on
+ * the order of floating-point operations, which the kernels, built
+ * with -funsafe-math-optimizations, do not preserve.
+ */
+#define PAIRWISE_LEVELS 48
+
+struct pairwise_sum_t {
+    uint64_t nblocks;                   /* blocks pushed so far */
+    uint32_t nvectors;                  /* vectors in "acc" since the last push */
+    resultvec_t level[PAIRWISE_LEVELS]; /* the sum of 2^k blocks, if bit k of nblocks is set */
+};
+
+static inline void
+pairwise_init(pairwise_sum_t &s)
+{
+    s.nblocks = 0;
+    s.nvectors = 0;
+}
+
+/* Move "acc" into the tree, merging the levels it completes. */
+static inline void
+pairwise_push(pairwise_sum_t &s, resultvec_t &acc)
+{
+    resultvec_t v = acc;
+    int k = 0;
+    for (uint64_t n = s.nblocks++; n & 1; n >>= 1, k++) v = s.level[k] + v;
+    s.level[k] = v;
+    acc = RESULTVEC_ZERO;
+    s.nvectors = 0;
+}
+
+/* The sum of all blocks pushed so far and of "acc", smallest first. */
+static inline resultvec_t
+pairwise_total(const pairwise_sum_t &s, const resultvec_t &acc)
+{
+    resultvec_t r = acc;
+    for (int k = 0; k < PAIRWISE_LEVELS; k++)
+        if (s.nblocks >> k & 1) r = r + s.level[k];
+    return r;
+}
+
+/* Squares of the real and imaginary parts, for variances */
+
+static inline real_t partwise_sqr(const real_t a) { return a*a; }
+static inline complex_t partwise_sqr(const complex_t a) { return complex_t{a.re*a.re, a.im*a.im}; }
+
+/*
+ * Given the results r[0..n) of n random shifts, store their mean in
+ * r[n] and the variance of that mean, separately for the real and
+ * the imaginary part, in r[n+1] (zero for a single shift).
+ */
+static inline void
+shift_statistics(result_t * restrict r, const uint64_t n)
+{
+    result_t mean, var;
+    mean = 0;
+    var = 0;
+    for (uint64_t j = 0; j < n; j++) mean = mean + r[j];
+    mean = mean*(1/(real_t)n);
+    for (uint64_t j = 0; j < n; j++) var = var + partwise_sqr(r[j] - mean);
+    if (n > 1) var = var*(1/((real_t)n*(n - 1)));
+    r[n] = mean;
+    r[n + 1] = var;
+}
+
+#if !defined(SECDEC_SINGLE) && !defined(SECDEC_DD)
+
+static inline real_t result_abs(const real_t a) { return fabs(a); }
+static inline real_t result_abs(const complex_t a) { return hypot(a.re, a.im); }
+
+/*
+ * The "__guarded" kernels. The first SECDEC_GUARD_POINTS points of
+ * [index1, index2) are summed in double precision ("dkernel") and in
+ * single precision ("skernel"); the rest of them in single precision
+ * only if the two sums agree to the relative "tolerance", and in
+ * double precision otherwise. A single-precision sum that fails a
+ * sign check is redone in double precision, so that only the checks
+ * that also fail there are reported.
+ */
+template <typename kernel_t>
+static inline int
+precision_guarded(
+    kernel_t *dkernel,
+    kernel_t *skernel,
+    result_t * restrict presult,
+    const uint64_t lattice,
+    const uint64_t index1,
+    const uint64_t index2,
+    const uint64_t * restrict genvec,
+    const real_t * restrict shift,
+    const real_t * restrict realp,
+    const complex_t * restrict complexp,
+    const real_t * restrict deformp,
+    const real_t tolerance
+)
+{
+    const uint64_t split = index2 - index1 > SECDEC_GUARD_POINTS ? index1 + SECDEC_GUARD_POINTS : index2;
+    result_t guard, check, rest;
+    int status = dkernel(&guard, lattice, index1, split, genvec, shift, realp, complexp, deformp);
+    if (status != 0 || split == index2) {
+        *presult = guard;
+        return status;
+    }
+    kernel_t *kernel = dkernel;
+    if (skernel(&check, lattice, index1, split, genvec, shift, realp, complexp, deformp) == 0 &&
+        result_abs(check - guard) <= tolerance*result_abs(guard))
+        kernel = skernel;
+    status = kernel(&rest, lattice, split, index2, genvec, shift, realp, complexp, deformp);
+    if (status != 0 && kernel == skernel)
+        status = dkernel(&rest, lattice, split, index2, genvec, shift, realp, complexp, deformp);
+    *presult = guard + rest;
+    return status;
+}
+
+#endif
+
+/* The double-double builds only need the periodizing transforms
+ * below, and load their points with load_lanes. */
+#ifndef SECDEC_DD
+
+/*
+ * Lane-granular sign checks. A "lanemask_t" has bit k set for lane k.
+ * The "__lanes" kernels do not give up on the first failing point:
+ * they leave every failing point out of the sum and list it in a
+ * sign_check_report_t, whose layout is part of their interface.
+ */
+
+typedef uint32_t lanemask_t;
+
+struct sign_check_report_t {
+    int32_t status;        /* 0, or the status (1, 2) of the first failing check */
+    int32_t check_id;      /* the id of that check */
+    uint64_t nfailed;      /* the number of lattice points left out */
+    uint64_t capacity;     /* the size of "indices" */
+    uint64_t *indices;     /* the first "capacity" of these lattice indices */
+};
+
+static inline void
+sign_check_report_reset(sign_check_report_t * restrict report)
+{
+    report->status = 0;
+    report->check_id = 0;
+    report->nfailed = 0;
+}
+
+/* The lanes where "!(a <= b)" or "!(a >= b)", NaN included. */
+static inline lanemask_t
+failing_lanes_le(const realvec_t &a, const real_t b)
+{
+    lanemask_t m = 0;
+    for (int k = 0; k < REALVEC_SIZE; k++) m |= (lanemask_t)!(a.x[k] <= b) << k;
+    return m;
+}
+
+static inline lanemask_t
+failing_lanes_ge(const realvec_t &a, const real_t b)
+{
+    lanemask_t m = 0;
+    for (int k = 0; k < REALVEC_SIZE; k++) m |= (lanemask_t)!(a.x[k] >= b) << k;
+    return m;
+}
+
+/*
+ * Add the lanes of "failing" before "index2" to "failed", noting the
+ * status and id of the check if it is the first one to fail. The
+ * points starting at "index" that make up "failed" are recorded once
+ * all checks are done, with sign_check_record().
+ */
+static inline lanemask_t
+sign_check_lanes(sign_check_report_t * restrict report, const lanemask_t failed, lanemask_t failing,
+                 const uint64_t index, const uint64_t index2, const int status, const int id)
+{
+    for (int k = 0; k < REALVEC_SIZE; k++)
+        if (index + k >= index2) failing &= ~((lanemask_t)1 << k);
+    if (likely((failing & ~failed) == 0)) return failed;
+    if (report->status == 0) {
+        report->status = status;
+        report->check_id = id;
+    }
+    return failed | failing;
+}
+
+static inline void
+sign_check_record(sign_check_report_t * restrict report, const lanemask_t failed, const uint64_t index)
+{
+    for (int k = 0; k < REALVEC_SIZE; k++) {
+        if (!(failed >> k & 1)) continue;
+        if (report->nfailed < report->capacity) report->indices[report->nfailed] = index + k;
+        report->nfailed++;
+    }
+}
+
+/* "a" with the lanes in "m" set to zero, whatever they held. */
+static inline realvec_t
+without_lanes(const realvec_t &a, const lanemask_t m)
+{
+    realvec_t r = a;
+    for (int k = 0; k < REALVEC_SIZE; k++) if (m >> k & 1) r.x[k] = 0;
+    return r;
+}
+
+static inline complexvec_t
+without_lanes(const complexvec_t &a, const lanemask_t m)
+{
+    complexvec_t r = a;
+    for (int k = 0; k < REALVEC_SIZE; k++) if (m >> k & 1) r.re[k] = r.im[k] = 0;
+    return r;
+}
+
+/* Lattice arithmetic */
+
+static inline int_t
+mulmod(const uint64_t a, const uint64_t b, const uint64_t n)
+{
+    return (int_t)((unsigned __int128)a*b % n);
+}
+
+/*
+ * a*b mod n for a, b < n, with the quotient estimated from the
+ * precomputed reciprocal "invn" (a floating-point Barrett reduction).
+ * The estimate is off by at most a few units for n < 2^50, which the
+ * correction steps absorb; larger lattices take the exact path.
+ */
+static inline int_t
+mulmod(const uint64_t a, const uint64_t b, const uint64_t n, const real_t invn)
+{
+    if (unlikely(n >= ((uint64_t)1 << 50))) return mulmod(a, b, n);
+    int_t q = (int_t)((real_t)a*(real_t)b*invn);
+    int_t r = (int_t)(a*b - (uint64_t)q*n);
+    while (r < 0) r += n;
+    while (r >= (int_t)n) r -= n;
+    return r;
+}
+
+static inline int_t
+warponce_i(const int_t a, const int_t b)
+{
+    return a >= b ? a - b : a;
+}
+
+static inline realvec_t
+warponce(const realvec_t &a, const real_t b)
+{
+    return realvec_t{vec_select(a.x >= (lane_t)b, a.x - (lane_t)b, a.x)};
+}
+
+/*
+ * Generator of the coordinates of consecutive lattice points along
+ * one dimension, REALVEC_SIZE points at a time: "li" holds the
+ * integer coordinates of the next points, one per lane, and is
+ * advanced by REALVEC_SIZE points with one vector addition and a
+ * conditional subtraction of the lattice size, instead of a chain of
+ * REALVEC_SIZE dependent scalar steps. The coordinates are kept as
+ * doubles, which hold them exactly for lattices below 2^52 and need
+ * no conversion per point. The single-precision builds keep them in
+ * SECDEC_COORD_PARTS vectors of half the width, which fit the
+ * registers that the single-precision lanes are sized for.
+ */
+#if defined(SECDEC_SINGLE) && REALVEC_SIZE > 1
+    #define SECDEC_COORD_PARTS 2
+#else
+    #define SECDEC_COORD_PARTS 1
+#endif
+#define SECDEC_COORD_SIZE (REALVEC_SIZE/SECDEC_COORD_PARTS)
+
+typedef real_t coordvec_native_t __attribute__((vector_size(SECDEC_COORD_SIZE*sizeof(real_t))));
+typedef lane_t coordvec_lane_t __attribute__((vector_size(SECDEC_COORD_SIZE*sizeof(lane_t))));
+
+struct lattice_iter_t {
+    coordvec_native_t li[SECDEC_COORD_PARTS];
+    real_t step;
+    real_t lattice;
+};
+
+static inline lattice_iter_t
+lattice_start(const uint64_t genvec_k, const uint64_t index, const uint64_t lattice, const real_t invlattice)
+{
+    lattice_iter_t it;
+    const uint64_t g = genvec_k % lattice;
+    for (int p = 0; p < SECDEC_COORD_PARTS; p++)
+        for (int k = 0; k < SECDEC_COORD_SIZE; k++)
+            it.li[p][k] = mulmod(g, (index + p*SECDEC_COORD_SIZE + k) % lattice, lattice, invlattice);
+    it.step = mulmod(g, REALVEC_SIZE % lattice, lattice, invlattice);
+    it.lattice = lattice;
+    return it;
+}
+
+/* Part "p" of the next points, as the lanes of "x". */
+static inline void
+lattice_store(realvec_t &x, const int p, const coordvec_native_t &c)
+{
+    const coordvec_lane_t v = __builtin_convertvector(c, coordvec_lane_t);
+    memcpy((char *)&x.x + p*sizeof(v), &v, sizeof(v));
+}
+
+static inline void
+lattice_advance(lattice_iter_t &it, const int p)
+{
+    it.li[p] += it.step;
+    it.li[p] = it.li[p] >= it.lattice ? it.li[p] - it.lattice : it.li[p];
+}
+
+/* The unshifted coordinates of the next REALVEC_SIZE points. */
+static inline realvec_t
+lattice_fractions(lattice_iter_t &it, const real_t invlattice)
+{
+    realvec_t x;
+    for (int p = 0; p < SECDEC_COORD_PARTS; p++) {
+        lattice_store(x, p, it.li[p]*invlattice);
+        lattice_advance(it, p);
+    }
+    return x;
+}
+
+/* The same points, shifted and wrapped into [0, 1) in double
+ * precision. */
+static inline realvec_t
+lattice_coordinates(lattice_iter_t &it, const real_t invlattice, const real_t shift_k)
+{
+    realvec_t x;
+    for (int p = 0; p < SECDEC_COORD_PARTS; p++) {
+        coordvec_native_t c = it.li[p]*invlattice + shift_k;
+        lattice_store(x, p, c >= 1 ? c - 1 : c);
+        lattice_advance(it, p);
+    }
+    return x;
+}
+
+/* Zero the weights of the lanes past the end of the index range.
+ * (Taken by reference: GCC notes the ABI of vectors wider than a
+ * register in the generic builds for every function that takes one
+ * by value, inlined or not, whatever the diagnostic pragmas say.) */
+static inline realvec_t
+mask_tail(const realvec_t &weights, const uint64_t index, const uint64_t index2)
+{
+    realvec_t w = weights;
+    for (int k = 1; k < REALVEC_SIZE; k++)
+        if (unlikely(index + k >= index2)) w.x[k] = 0;
+    return w;
+}
+
+#ifndef SECDEC_SINGLE
+
+/*
+ * Double-double refinement in the "__refined" kernels. A sum that the
+ * integrand factors through, such as the argument of a denominator
+ * or a Jacobian cofactor, has lost about -log2(cancellation) bits in
+ * the lanes where its magnitude is below "cancellation" times the sum
+ * of the magnitudes of its terms. The points of those lanes are
+ * evaluated once more by the double-double build of the integrand,
+ * from their untransformed coordinates (store_lanes).
+ */
+static inline real_t magnitude(const real_t a) { return fabs(a); }
+static inline real_t magnitude(const complex_t a) { return fabs(a.re) + fabs(a.im); }
+static inline realvec_t magnitude(const realvec_t &a) { return SecDecInternalAbs(a); }
+static inline realvec_t
+magnitude(const complexvec_t &a)
+{
+    return SecDecInternalAbs(realvec_t{a.re}) + SecDecInternalAbs(realvec_t{a.im});
+}
+
+static inline lanemask_t
+cancelled_lanes(const realvec_t &sum, const realvec_t &scale, const real_t cancellation)
+{
+    lanemask_t m = 0;
+    for (int k = 0; k < REALVEC_SIZE; k++) m |= (lanemask_t)(sum.x[k] < cancellation*scale.x[k]) << k;
+    return m;
+}
+
+/* A sum of parameters only, the same in every lane */
+static inline lanemask_t
+cancelled_lanes(const real_t sum, const real_t scale, const real_t cancellation)
+{
+    return sum < cancellation*scale ? (lanemask_t)(((uint64_t)1 << REALVEC_SIZE) - 1) : 0;
+}
+
+/* The lanes of "m" before "index2", for points starting at "index". */
+static inline lanemask_t
+lanes_before(lanemask_t m, const uint64_t index, const uint64_t index2)
+{
+    for (int k = 1; k < REALVEC_SIZE; k++)
+        if (index + k >= index2) m &= ~((lanemask_t)1 << k);
+    return m;
+}
+
+static inline void
+store_lanes(real_t * restrict us, const realvec_t &x)
+{
+    memcpy(us, &x.x, sizeof(x.x));
+}
+
+/* "a" with the lanes in "m" taken from "r" */
+static inline realvec_t
+with_lanes(const realvec_t &a, const lanemask_t m, const real_t * restrict r)
+{
+    realvec_t v = a;
+    for (int k = 0; k < REALVEC_SIZE; k++) if (m >> k & 1) v.x[k] = r[k];
+    return v;
+}
+
+static inline complexvec_t
+with_lanes(const complexvec_t &a, const lanemask_t m, const complex_t * restrict r)
+{
+    complexvec_t v = a;
+    for (int k = 0; k < REALVEC_SIZE; k++) {
+        if (!(m >> k & 1)) continue;
+        v.re[k] = r[k].re;
+        v.im[k] = r[k].im;
+    }
+    return v;
+}
+
+#endif
+
+#else
+
+/* The points of one "__point" call, given one vector per variable */
+static inline realvec_t
+load_lanes(const real_t * restrict us)
+{
+    realvec_t x;
+    memcpy(&x.x.hi, us, sizeof(x.x.hi));
+    x.x.lo = (ddvec_part_t){};
+    return x;
+}
+
+static inline void
+store_results(real_t * restrict r, const realvec_t &a)
+{
+    for (int k = 0; k < REALVEC_SIZE; k++) r[k] = a.x[k];
+}
+
+static inline void
+store_results(complex_t * restrict r, const complexvec_t &a)
+{
+    for (int k = 0; k < REALVEC_SIZE; k++) r[k] = complex_t{a.re[k], a.im[k]};
+}
+
+#endif
+
+/* Periodizing transforms */
+
+static inline realvec_t
+korobov3x3_w(const realvec_t &x)
+{
+    realvec_native_t u = x.x*(1 - x.x);
+    return realvec_t{140*u*u*u};
+}
+
+static inline realvec_t
+korobov3x3_f(const realvec_t &x)
+{
+    realvec_native_t y = x.x;
+    realvec_native_t y2 = y*y;
+    return realvec_t{y2*y2*(35 + y*(-84 + y*(70 - 20*y)))};
+}
+
+#if !defined(SECDEC_SINGLE) && !defined(SECDEC_DD)
+
+/*
+ * Transforms selected at run time by the "__transform" kernels. The
+ * id names the transform as in pySecDec: "none", "baker",
+ * "korobov<r0>x<r1>" with weight x^r0 (1-x)^r1 and "sidi<r>" with
+ * weight sin^r(pi x), for degrees 1 to 6.
+ */
+#define SECDEC_TRANSFORM_NONE 0
+#define SECDEC_TRANSFORM_BAKER 1
+#define SECDEC_TRANSFORM_KOROBOV(r0, r1) (0x100 | (r0) << 4 | (r1))
+#define SECDEC_TRANSFORM_SIDI(r) (0x200 | (r))
+
+struct transform_t {
+    int kind;          /* the id with the degrees set to 0, or -1 */
+    int r0, r1;        /* the degrees; Sidi only uses r0 */
+    real_t c;          /* the normalization of the weight */
+    real_t a[7];       /* korobov: f(x) = x^(r0+1) (a[0] + a[1] x + ... + a[r1] x^r1) */
+};
+
+/* The transform with the given id; kind is -1 if the id is unknown. */
+static inline transform_t
+transform_init(const int id)
+{
+    transform_t t = {-1, 0, 0, 0, {0}};
+    const int kind = id & ~0xff, r0 = id >> 4 & 0xf, r1 = id & 0xf;
+    if (id == SECDEC_TRANSFORM_NONE || id == SECDEC_TRANSFORM_BAKER) {
+        t.kind = id;
+    } else if (kind == SECDEC_TRANSFORM_KOROBOV(0, 0) && r0 >= 1 && r0 <= 6 && r1 >= 1 && r1 <= 6) {
+        /* c = (r0 + r1 + 1)!/(r0! r1!); a[k] = c binomial(r1, k) (-1)^k/(r0 + k + 1) */
+        real_t c = 1;
+        for (int k = 1; k <= r1; k++) c = c*(r0 + k)/k;
+        c *= r0 + r1 + 1;
+        real_t binomial = 1;
+        for (int k = 0; k <= r1; k++) {
+            t.a[k] = (k % 2 ? -c : c)*binomial/(r0 + k + 1);
+            binomial = binomial*(r1 - k)/(k + 1);
+        }
+        t.kind = kind; t.r0 = r0; t.r1 = r1; t.c = c;
+    } else if (kind == SECDEC_TRANSFORM_SIDI(0) && r0 == 0 && r1 >= 1 && r1 <= 6) {
+        /* c = 1/int_0^1 sin^r(pi x) dx, from the recurrence I_r = (r-1)/r I_(r-2) */
+        real_t norm = r1 % 2 ? 2/M_PI : 1;
+        for (int r = 2 + r1 % 2; r <= r1; r += 2) norm = norm*(r - 1)/r;
+        t.kind = kind; t.r0 = r1; t.c = 1/norm;
+    }
+    return t;
+}
+
+static inline realvec_t
+transform_pow(const realvec_native_t &x, const int n)
+{
+    realvec_t p = {x};
+    for (int k = 1; k < n; k++) p.x *= x;
+    return p;
+}
+
+/* The sine and cosine of pi x, lane by lane. */
+static inline void
+transform_sincospi(const realvec_t &x, realvec_native_t &s, realvec_native_t &c)
+{
+    for (int k = 0; k < REALVEC_SIZE; k++) {
+        s[k] = sin(M_PI*x.x[k]);
+        c[k] = cos(M_PI*x.x[k]);
+    }
+}
+
+static inline realvec_t
+transform_w(const transform_t &t, const realvec_t &x)
+{
+    switch (t.kind) {
+    case SECDEC_TRANSFORM_KOROBOV(0, 0):
+        if (t.r0 == t.r1) return realvec_t{t.c*transform_pow(x.x*(1 - x.x), t.r0).x};
+        return realvec_t{t.c*transform_pow(x.x, t.r0).x*transform_pow(1 - x.x, t.r1).x};
+    case SECDEC_TRANSFORM_SIDI(0): {
+        realvec_native_t s, c;
+        transform_sincospi(x, s, c);
+        return realvec_t{t.c*transform_pow(s, t.r0).x};
+    }
+    default:
+        return realvec_t{(realvec_native_t){} + 1};
+    }
+}
+
+static inline realvec_t
+transform_f(const transform_t &t, const realvec_t &x)
+{
+    switch (t.kind) {
+    case SECDEC_TRANSFORM_BAKER:
+        return realvec_t{x.x < 0.5 ? 2*x.x : 2 - 2*x.x};
+    case SECDEC_TRANSFORM_KOROBOV(0, 0): {
+        realvec_native_t p = (realvec_native_t){} + t.a[t.r1];
+        for (int k = t.r1 - 1; k >= 0; k--) p = p*x.x + t.a[k];
+        return realvec_t{transform_pow(x.x, t.r0 + 1).x*p};
+    }
+    case SECDEC_TRANSFORM_SIDI(0): {
+        /* int_0^x sin^r(pi y) dy = -sin^(r-1)(pi x) cos(pi x)/(r pi) + (r-1)/r int_0^x sin^(r-2)(pi y) dy */
+        realvec_native_t s, c;
+        transform_sincospi(x, s, c);
+        realvec_native_t integral = t.r0 % 2 ? (1 - c)*(1/M_PI) : x.x;
+        realvec_native_t sp = t.r0 % 2 ? s : (realvec_native_t){} + 1;
+        for (int r = 2 + t.r0 % 2; r <= t.r0; r += 2) {
+            integral = (r - 1)*(1.0/r)*integral - sp*s*c*(1/(r*M_PI));
+            sp *= s*s;
+        }
+        return realvec_t{t.c*integral};
+    }
+    default:
+        return x;
+    }
+}
+
+#endif
+
+#endif
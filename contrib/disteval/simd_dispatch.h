@@ -0,0 +1,88 @@
+#ifndef SECDEC_SIMD_DISPATCH_H
+#define SECDEC_SIMD_DISPATCH_H
+
+/*
+ * Load-time selection between the per-ISA builds of the disteval
+ * CPU kernels. A kernel source compiled with SECDEC_DISPATCH
+ * defines, for every kernel, the unsuffixed symbol that the
+ * disteval driver looks up; it forwards to the "__scalar",
+ * "__avx2" or "__avx512" build picked once, when the library is
+ * loaded, from CPUID. The choice can be forced by setting
+ * SECDEC_DISTEVAL_ISA to one of those names; a build that the CPU
+ * cannot run, or an unknown name, is reported on stderr and the
+ * one from CPUID is used instead.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum secdec_isa_t { SECDEC_ISA_SCALAR = 0, SECDEC_ISA_AVX2 = 1, SECDEC_ISA_AVX512 = 2 };
+
+static const char * const secdec_isa_names[] = { "scalar", "avx2", "avx512" };
+
+/* the widest build that the CPU can run */
+static inline int
+secdec_isa_supported()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        return SECDEC_ISA_AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SECDEC_ISA_AVX2;
+#endif
+    return SECDEC_ISA_SCALAR;
+}
+
+static inline int
+secdec_isa_detect()
+{
+    const int supported = secdec_isa_supported();
+    const char *forced = getenv("SECDEC_DISTEVAL_ISA");
+    if (forced == NULL)
+        return supported;
+    for (int isa = SECDEC_ISA_SCALAR; isa <= SECDEC_ISA_AVX512; isa++) {
+        if (strcmp(forced, secdec_isa_names[isa]) != 0)
+            continue;
+        if (isa <= supported)
+            return isa;
+        fprintf(stderr, "SECDEC_DISTEVAL_ISA=%s: not supported by this CPU, using %s\n",
+                forced, secdec_isa_names[supported]);
+        return supported;
+    }
+    fprintf(stderr, "SECDEC_DISTEVAL_ISA=%s: unknown, expected scalar, avx2 or avx512; using %s\n",
+            forced, secdec_isa_names[supported]);
+    return supported;
+}
+
+static inline int
+secdec_isa()
+{
+    static const int isa = secdec_isa_detect();
+    return isa;
+}
+
+template <typename F> static inline F *
+secdec_isa_select(F *scalar, F *avx2, F *avx512)
+{
+    switch (secdec_isa()) {
+        case SECDEC_ISA_AVX512: return avx512;
+        case SECDEC_ISA_AVX2: return avx2;
+        default: return scalar;
+    }
+}
+
+/*
+ * SECDEC_DISPATCH_KERNEL(int, name, (params...), (args...))
+ * declares the three builds of "name" and defines "name" itself.
+ */
+#define SECDEC_DISPATCH_KERNEL(rettype, name, params, args) \
+    extern "C" rettype name##__scalar params; \
+    extern "C" rettype name##__avx2 params; \
+    extern "C" rettype name##__avx512 params; \
+    static rettype (* const name##__selected) params = \
+        secdec_isa_select(name##__scalar, name##__avx2, name##__avx512); \
+    extern "C" rettype name params { return name##__selected args; }
+
+#endif
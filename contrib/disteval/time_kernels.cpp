@@ -0,0 +1,152 @@
+/*
+ * Times the double-precision integrand kernels of a disteval library
+ * on a fixed lattice, for "make autotune" (see contrib/bin/autotune).
+ *
+ *     time_kernels <library> <lattice> <repeats> <dimension>
+ *         <deformp count> <realp> <complexp> <kernel>...
+ *
+ * <realp> and <complexp> are comma-separated lists, the latter of
+ * real and imaginary parts; "-" stands for an empty list. With a
+ * contour deformation, every kernel starts from the deformation
+ * parameters that its "__maxdeformp" kernel returns on the lattice,
+ * capped at 1, and halves them until no sign check fails, as the
+ * presampling does. Every kernel then runs <repeats> times over the
+ * whole lattice; the shortest time is printed, one kernel per line,
+ * as "<kernel> <seconds>".
+ */
+
+#include <dlfcn.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+typedef struct { double re, im; } complex_value_t;
+
+typedef int kernel_t(
+    complex_value_t *presult,
+    const uint64_t lattice,
+    const uint64_t index1,
+    const uint64_t index2,
+    const uint64_t *genvec,
+    const double *shift,
+    const double *realp,
+    const complex_value_t *complexp,
+    const double *deformp
+);
+
+typedef void maxdeformp_t(
+    double *maxdeformp,
+    const uint64_t lattice,
+    const uint64_t index1,
+    const uint64_t index2,
+    const uint64_t *genvec,
+    const double *shift,
+    const double *realp,
+    const complex_value_t *complexp
+);
+
+static std::vector<double>
+parse_list(const char *text)
+{
+    std::vector<double> values;
+    if (strcmp(text, "-") == 0) return values;
+    for (const char *p = text; *p; ) {
+        char *end;
+        values.push_back(strtod(p, &end));
+        if (end == p) {
+            fprintf(stderr, "time_kernels: not a number list: %s\n", text);
+            exit(2);
+        }
+        p = *end == ',' ? end + 1 : end;
+    }
+    return values;
+}
+
+static void *
+symbol(void *library, const char *name)
+{
+    void *f = dlsym(library, name);
+    if (f == NULL) {
+        fprintf(stderr, "time_kernels: %s\n", dlerror());
+        exit(2);
+    }
+    return f;
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 9) {
+        fprintf(stderr, "usage: time_kernels <library> <lattice> <repeats> <dimension> <deformp count> <realp> <complexp> <kernel>...\n");
+        return 2;
+    }
+    void *library = dlopen(argv[1], RTLD_LAZY | RTLD_LOCAL);
+    if (library == NULL) {
+        fprintf(stderr, "time_kernels: %s\n", dlerror());
+        return 2;
+    }
+    const uint64_t lattice = strtoull(argv[2], NULL, 10);
+    const int repeats = atoi(argv[3]);
+    const int dimension = atoi(argv[4]);
+    const int ndeformp = atoi(argv[5]);
+    std::vector<double> realp = parse_list(argv[6]);
+    std::vector<double> complexp = parse_list(argv[7]);
+    realp.push_back(0);
+    complexp.push_back(0);
+    complexp.push_back(0);
+
+    // a Korobov lattice: timing does not need a good one
+    std::vector<uint64_t> genvec(dimension);
+    std::vector<double> shift(dimension);
+    for (int k = 0; k < dimension; k++) {
+        genvec[k] = k == 0 ? 1 : (unsigned __int128)genvec[k - 1]*7919 % lattice;
+        shift[k] = 0.5 + 0.5*k/dimension;
+    }
+
+    for (int i = 8; i < argc; i++) {
+        kernel_t *kernel = (kernel_t *)symbol(library, argv[i]);
+        std::vector<double> deformp(ndeformp + 1, 0);
+        complex_value_t result[2];
+        if (ndeformp > 0) {
+            // argv[i] is "<kernel><isa suffix>"; the suffix follows "_order_<k>"
+            const char *order = strstr(argv[i], "_order_");
+            const char *suffix = order == NULL ? NULL : strstr(order + 7, "__");
+            std::string name(argv[i], suffix == NULL ? strlen(argv[i]) : suffix - argv[i]);
+            name += "__maxdeformp";
+            if (suffix != NULL) name += suffix;
+            maxdeformp_t *maxdeformp = (maxdeformp_t *)symbol(library, name.c_str());
+            maxdeformp(deformp.data(), lattice, 0, lattice, genvec.data(), shift.data(), realp.data(),
+                       (const complex_value_t *)complexp.data());
+            for (int k = 0; k < ndeformp; k++) deformp[k] = std::min(deformp[k], 1.0);
+            int attempt = 0;
+            while (kernel(result, lattice, 0, lattice, genvec.data(), shift.data(), realp.data(),
+                          (const complex_value_t *)complexp.data(), deformp.data()) != 0) {
+                if (++attempt == 30) {
+                    fprintf(stderr, "time_kernels: %s: the sign checks fail for any deformation\n", argv[i]);
+                    return 1;
+                }
+                for (int k = 0; k < ndeformp; k++) deformp[k] *= 0.5;
+            }
+        }
+        double best = 0;
+        for (int r = 0; r < repeats; r++) {
+            auto start = std::chrono::steady_clock::now();
+            int status = kernel(result, lattice, 0, lattice, genvec.data(), shift.data(), realp.data(),
+                                (const complex_value_t *)complexp.data(), deformp.data());
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (status != 0) {
+                fprintf(stderr, "time_kernels: %s: status %d\n", argv[i], status);
+                return 1;
+            }
+            if (r == 0 || seconds < best) best = seconds;
+        }
+        printf("%s %.6f\n", argv[i], best);
+    }
+    return 0;
+}
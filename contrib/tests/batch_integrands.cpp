@@ -0,0 +1,47 @@
+/*
+ * Checks that the batched integrands of get_batch_integrands() give
+ * the same bits as the integrands of get_sectors() at the same points,
+ * for a number of points that no vector width divides.
+ */
+
+#include "check.hpp"
+
+#include <random>
+
+int main()
+{
+    const std::vector<package::real_t> real_parameters(package::number_of_real_parameters, 1.5);
+    const std::vector<package::complex_t> complex_parameters(package::number_of_complex_parameters, package::complex_t(1.5, 0.5));
+    const unsigned long long count = 1021;
+
+    const auto sectors = flatten(package::get_sectors());
+    const auto batch_integrands = flatten(package::get_batch_integrands());
+    CHECK(sectors.size() == batch_integrands.size());
+
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<package::real_t> uniform(0., 1.);
+    for (size_t i = 0; i < sectors.size() && i < batch_integrands.size(); ++i)
+    {
+        const unsigned dimension = sectors[i]->number_of_integration_variables;
+        const std::vector<package::real_t> deformation_parameters(dimension, 0.1);
+        std::vector<package::real_t> integration_variables(dimension*count);
+        for (package::real_t& x : integration_variables)
+            x = uniform(generator);
+
+        std::vector<package::integrand_return_t> results(count);
+        secdecutil::ResultInfo batch_result_info;
+        (*batch_integrands[i])(count, integration_variables.data(), real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &batch_result_info, results.data());
+
+        secdecutil::ResultInfo result_info;
+        std::vector<package::real_t> point(dimension);
+        for (unsigned long long j = 0; j < count; ++j)
+        {
+            for (unsigned k = 0; k < dimension; ++k)
+                point[k] = integration_variables[k*count + j];
+            const package::integrand_return_t result = sectors[i]->undeformed_integrand(point.data(), real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info);
+            CHECK(same_bits(result, results[j]));
+        }
+        CHECK(batch_result_info.return_value == result_info.return_value);
+    }
+    return failed_checks != 0;
+}
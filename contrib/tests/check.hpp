@@ -0,0 +1,81 @@
+/*
+ * Shared by the tests in this directory, which "make check" in an
+ * integral directory builds against its lib<name>.a and runs (see the
+ * integral Makefile). The package is chosen at compile time with
+ *
+ *     -DSECDEC_TEST_PACKAGE=<name> -DSECDEC_TEST_HEADER='"<name>.hpp"'
+ *
+ * and needs a contour deformation. Every test is a program that prints
+ * the checks that failed and exits with 1 if there are any.
+ */
+
+#ifndef SECDEC_TESTS_CHECK_HPP
+#define SECDEC_TESTS_CHECK_HPP
+
+#include SECDEC_TEST_HEADER
+
+#include <secdecutil/deep_apply.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace package = SECDEC_TEST_PACKAGE;
+
+static int failed_checks = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failed_checks; \
+        } \
+    } while (0)
+
+// the entries of every sector and order of "series", in the order that
+// deep_apply visits them, which is the same for all results of the
+// package
+template<typename T>
+static std::vector<const T*> flatten(const std::vector<package::nested_series_t<T>>& series)
+{
+    std::vector<const T*> entries;
+    secdecutil::deep_apply
+    (
+        series,
+        [&entries] (const T& entry) { entries.push_back(&entry); return 0; }
+    );
+    return entries;
+}
+
+// whether "a" and "b" have the same bits, so that equal NaNs compare
+// equal and 0. and -0. do not
+template<typename T>
+static bool same_bits(const T& a, const T& b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// the result of optimize_deformation_parameters()
+typedef std::vector<package::nested_series_t<package::optimized_deformation_parameters_t>> deformation_parameters_t;
+
+// whether all sectors and orders of "a" and "b" have the same
+// deformation parameters, bit for bit, and numbers of presamples
+inline bool same_deformation_parameters(const deformation_parameters_t& a, const deformation_parameters_t& b)
+{
+    const auto entries_a = flatten(a);
+    const auto entries_b = flatten(b);
+    if (entries_a.size() != entries_b.size())
+        return false;
+    for (size_t i = 0; i < entries_a.size(); ++i)
+    {
+        if (entries_a[i]->number_of_presamples != entries_b[i]->number_of_presamples ||
+            entries_a[i]->deformation_parameters.size() != entries_b[i]->deformation_parameters.size())
+            return false;
+        for (size_t k = 0; k < entries_a[i]->deformation_parameters.size(); ++k)
+            if (!same_bits(entries_a[i]->deformation_parameters[k], entries_b[i]->deformation_parameters[k]))
+                return false;
+    }
+    return true;
+}
+
+#endif
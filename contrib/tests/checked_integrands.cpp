@@ -0,0 +1,72 @@
+/*
+ * Checks that the integrands of get_checked_integrands() give the same
+ * bits and the same sign check result as the integrands of
+ * get_sectors(), and that the values they report for the sign checks
+ * pass them exactly when no sign check fails, and that the deformation
+ * parameters of optimize_deformation_parameters() pass these sign checks
+ * at the points presampled.
+ */
+
+#include "check.hpp"
+
+#include <random>
+
+int main()
+{
+    const std::vector<package::real_t> real_parameters(package::number_of_real_parameters, 1.5);
+    const std::vector<package::complex_t> complex_parameters(package::number_of_complex_parameters, package::complex_t(1.5, 0.5));
+    const unsigned number_of_points = 1000;
+
+    const auto sectors = flatten(package::get_sectors());
+    const auto checked_integrands = flatten(package::get_checked_integrands());
+    CHECK(sectors.size() == checked_integrands.size());
+
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<package::real_t> uniform(0., 1.);
+    for (size_t i = 0; i < sectors.size() && i < checked_integrands.size(); ++i)
+    {
+        const unsigned dimension = sectors[i]->number_of_integration_variables;
+        std::vector<package::real_t> integration_variables(dimension);
+        // large enough for some sign checks to fail
+        for (const package::real_t deformation_parameter : {0.1, 1.})
+        {
+            const std::vector<package::real_t> deformation_parameters(dimension, deformation_parameter);
+            for (unsigned j = 0; j < number_of_points; ++j)
+            {
+                for (package::real_t& x : integration_variables)
+                    x = uniform(generator);
+                secdecutil::ResultInfo result_info, checked_result_info;
+                const package::integrand_return_t result = sectors[i]->undeformed_integrand(integration_variables.data(), real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info);
+                package::real_t contour_deformation_check, positive_polynomial_check;
+                const package::integrand_return_t checked_result = (*checked_integrands[i])(integration_variables.data(), real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &checked_result_info, &contour_deformation_check, &positive_polynomial_check);
+                CHECK(same_bits(result, checked_result));
+                CHECK(result_info.return_value == checked_result_info.return_value);
+                const bool passed = contour_deformation_check <= 0 && positive_polynomial_check >= 0;
+                CHECK(passed == (checked_result_info.return_value == secdecutil::ResultInfo::ReturnValue::no_error));
+            }
+        }
+    }
+
+    // a single stage, so that the points presampled are the first
+    // "number_of_presamples" of a generator seeded with it
+    const unsigned number_of_presamples = 1000;
+    const deformation_parameters_t optimized = package::optimize_deformation_parameters(real_parameters, complex_parameters, number_of_presamples, 1., 1.e-5, 0.9, number_of_presamples);
+    const auto presampled = flatten(optimized);
+    CHECK(presampled.size() == checked_integrands.size());
+    for (size_t i = 0; i < presampled.size() && i < sectors.size(); ++i)
+    {
+        const unsigned dimension = sectors[i]->number_of_integration_variables;
+        std::vector<package::real_t> integration_variables(dimension);
+        std::mt19937_64 presampling_generator(number_of_presamples);
+        for (unsigned j = 0; j < number_of_presamples; ++j)
+        {
+            for (package::real_t& x : integration_variables)
+                x = uniform(presampling_generator);
+            secdecutil::ResultInfo result_info;
+            package::real_t contour_deformation_check, positive_polynomial_check;
+            (*checked_integrands[i])(integration_variables.data(), real_parameters.data(), complex_parameters.data(), presampled[i]->deformation_parameters.data(), &result_info, &contour_deformation_check, &positive_polynomial_check);
+            CHECK(contour_deformation_check <= 0 && positive_polynomial_check >= 0);
+        }
+    }
+    return failed_checks != 0;
+}
@@ -0,0 +1,53 @@
+/*
+ * Checks that the contour deformation polynomials of
+ * get_contour_deformation_prefixes(), evaluated from a prefix stored
+ * once per point, give the same bits as those of get_sectors() for
+ * several deformation parameters, and that the maximal deformation
+ * parameters of both agree.
+ */
+
+#include "check.hpp"
+
+#include <random>
+
+int main()
+{
+    const std::vector<package::real_t> real_parameters(package::number_of_real_parameters, 1.5);
+    const std::vector<package::complex_t> complex_parameters(package::number_of_complex_parameters, package::complex_t(1.5, 0.5));
+    const unsigned number_of_points = 1000;
+
+    const auto sectors = flatten(package::get_sectors());
+    const auto prefixes = flatten(package::get_contour_deformation_prefixes());
+    CHECK(sectors.size() == prefixes.size());
+
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<package::real_t> uniform(0., 1.);
+    for (size_t i = 0; i < sectors.size() && i < prefixes.size(); ++i)
+    {
+        const unsigned dimension = sectors[i]->number_of_integration_variables;
+        CHECK(prefixes[i]->number_of_integration_variables == dimension);
+        std::vector<package::real_t> integration_variables(dimension), prefix(prefixes[i]->prefix_size);
+        std::vector<package::real_t> maximal(dimension), prefixed_maximal(dimension);
+        for (unsigned j = 0; j < number_of_points; ++j)
+        {
+            for (package::real_t& x : integration_variables)
+                x = uniform(generator);
+            prefixes[i]->prefix(integration_variables.data(), real_parameters.data(), complex_parameters.data(), prefix.data());
+            for (const package::real_t deformation_parameter : {0., 0.1, 1.})
+            {
+                const std::vector<package::real_t> deformation_parameters(dimension, deformation_parameter);
+                secdecutil::ResultInfo result_info, prefixed_result_info;
+                const package::integrand_return_t result = sectors[i]->contour_deformation_polynomial(integration_variables.data(), real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info);
+                const package::integrand_return_t prefixed_result = prefixes[i]->polynomial(prefix.data(), real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &prefixed_result_info);
+                CHECK(same_bits(result, prefixed_result));
+                CHECK(result_info.return_value == prefixed_result_info.return_value);
+            }
+            secdecutil::ResultInfo result_info;
+            sectors[i]->maximal_allowed_deformation_parameters(maximal.data(), integration_variables.data(), real_parameters.data(), complex_parameters.data(), &result_info);
+            prefixes[i]->maximal_allowed_deformation_parameters(prefixed_maximal.data(), integration_variables.data(), real_parameters.data(), complex_parameters.data(), &result_info);
+            for (unsigned k = 0; k < dimension; ++k)
+                CHECK(same_bits(maximal[k], prefixed_maximal[k]));
+        }
+    }
+    return failed_checks != 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * Checks the deformation parameter cache of
+ * optimize_deformation_parameters() in a fresh directory: a second
+ * call at the same point returns the same deformation parameters
+ * without appending to the cache file, and a partial record left at
+ * its end by an interrupted append neither hides the records before
+ * it nor survives the next append.
+ */
+
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+static long long file_size(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return file ? static_cast<long long>(file.tellg()) : -1;
+}
+
+int main()
+{
+    char directory[] = "/tmp/secdec_cache_XXXXXX";
+    if (!mkdtemp(directory))
+    {
+        std::perror("mkdtemp");
+        return 1;
+    }
+    setenv("SECDEC_DEFORMATION_PARAMETERS_CACHE", directory, 1);
+    const std::string filename = std::string(directory) + "/" + package::package_name + ".deformation_parameters";
+
+    std::vector<package::real_t> real_parameters(package::number_of_real_parameters, 1.5);
+    const std::vector<package::complex_t> complex_parameters(package::number_of_complex_parameters, package::complex_t(1.5, 0.5));
+    const unsigned number_of_presamples = 16384;
+    const auto optimize = [&] ()
+    {
+        return package::optimize_deformation_parameters(real_parameters, complex_parameters, number_of_presamples);
+    };
+
+    const deformation_parameters_t first = optimize();
+    // the header is 8 bytes of magic, the record size and 4 reserved bytes
+    const long long header_size = 16;
+    const long long first_size = file_size(filename);
+    std::uint32_t record_size = 0;
+    {
+        std::ifstream file(filename, std::ios::binary);
+        file.seekg(8);
+        file.read(reinterpret_cast<char*>(&record_size), sizeof(record_size));
+    }
+    const long long number_of_entries = flatten(first).size();
+    CHECK(record_size > 0);
+    CHECK(first_size == header_size + number_of_entries*record_size);
+
+    CHECK(same_deformation_parameters(optimize(), first));
+    CHECK(file_size(filename) == first_size);
+
+    // an interrupted append
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::app);
+        file.write("\x01\x02\x03\x04\x05", 5);
+    }
+    CHECK(same_deformation_parameters(optimize(), first));
+    CHECK(file_size(filename) == first_size + 5);
+
+    real_parameters[0] = 2.5;
+    const deformation_parameters_t second = optimize();
+    CHECK(file_size(filename) == first_size + number_of_entries*record_size);
+    CHECK(same_deformation_parameters(optimize(), second));
+    CHECK(file_size(filename) == first_size + number_of_entries*record_size);
+
+    real_parameters[0] = 1.5;
+    CHECK(same_deformation_parameters(optimize(), first));
+    CHECK(file_size(filename) == first_size + number_of_entries*record_size);
+
+    unlink(filename.c_str());
+    rmdir(directory);
+    return failed_checks != 0;
+}
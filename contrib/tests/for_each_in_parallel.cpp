@@ -0,0 +1,68 @@
+/*
+ * Checks that for_each_in_parallel() calls the body exactly once for
+ * every index, on no more threads than asked for, and that an
+ * exception of the body reaches the caller only after all indices
+ * have been visited.
+ */
+
+#include "check.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+int main()
+{
+    for (const unsigned long long count : {0ull, 1ull, 5ull, 1000ull})
+    {
+        for (const unsigned number_of_threads : {0u, 1u, 2u, 3u, 7u})
+        {
+            std::unique_ptr<std::atomic<unsigned>[]> calls(new std::atomic<unsigned>[count]());
+            std::set<std::thread::id> threads;
+            std::mutex threads_mutex;
+            package::for_each_in_parallel
+            (
+                count,
+                [&] (unsigned long long i)
+                {
+                    ++calls[i];
+                    std::lock_guard<std::mutex> lock(threads_mutex);
+                    threads.insert(std::this_thread::get_id());
+                },
+                number_of_threads
+            );
+            for (unsigned long long i = 0; i < count; ++i)
+                CHECK(calls[i] == 1);
+            if (number_of_threads != 0)
+                CHECK(threads.size() <= number_of_threads);
+
+            std::unique_ptr<std::atomic<unsigned>[]> throwing_calls(new std::atomic<unsigned>[count]());
+            bool thrown = false;
+            try
+            {
+                package::for_each_in_parallel
+                (
+                    count,
+                    [&] (unsigned long long i)
+                    {
+                        ++throwing_calls[i];
+                        if (i % 3 == 1)
+                            throw std::runtime_error("index " + std::to_string(i));
+                    },
+                    number_of_threads
+                );
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            CHECK(thrown == (count > 1));
+            for (unsigned long long i = 0; i < count; ++i)
+                CHECK(throwing_calls[i] == 1);
+        }
+    }
+    return failed_checks != 0;
+}
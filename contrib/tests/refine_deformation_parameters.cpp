@@ -0,0 +1,64 @@
+/*
+ * Checks refine_deformation_parameters() on the result of
+ * optimize_deformation_parameters(): it keeps the numbers of
+ * presamples and of deformation parameters, stays within the bounds,
+ * gives the same result every time, only lowers deformation parameters
+ * to the bounds without any round, and leaves them as they are with
+ * fewer than two samples.
+ */
+
+#include "check.hpp"
+
+#include <stdexcept>
+
+int main()
+{
+    const std::vector<package::real_t> real_parameters(package::number_of_real_parameters, 1.5);
+    const std::vector<package::complex_t> complex_parameters(package::number_of_complex_parameters, package::complex_t(1.5, 0.5));
+    const package::real_t maximum = 1., minimum = 1.e-5;
+    const auto refine = [&] (const deformation_parameters_t& optimized, unsigned number_of_samples, unsigned number_of_rounds)
+    {
+        return package::refine_deformation_parameters(real_parameters, complex_parameters, optimized, number_of_samples, number_of_rounds, maximum, minimum);
+    };
+
+    unsetenv("SECDEC_DEFORMATION_PARAMETERS_CACHE");
+    const deformation_parameters_t optimized = package::optimize_deformation_parameters(real_parameters, complex_parameters, 16384);
+    const deformation_parameters_t refined = refine(optimized, 1024, 8);
+    const deformation_parameters_t unrefined = refine(optimized, 1024, 0);
+    const auto optimized_entries = flatten(optimized);
+    const auto refined_entries = flatten(refined);
+    const auto unrefined_entries = flatten(unrefined);
+    CHECK(optimized_entries.size() == refined_entries.size());
+    CHECK(optimized_entries.size() == unrefined_entries.size());
+    for (size_t i = 0; i < optimized_entries.size() && i < refined_entries.size() && i < unrefined_entries.size(); ++i)
+    {
+        const std::vector<package::real_t>& initial = optimized_entries[i]->deformation_parameters;
+        CHECK(refined_entries[i]->number_of_presamples == optimized_entries[i]->number_of_presamples);
+        CHECK(refined_entries[i]->deformation_parameters.size() == initial.size());
+        CHECK(unrefined_entries[i]->deformation_parameters.size() == initial.size());
+        for (size_t k = 0; k < initial.size() && k < refined_entries[i]->deformation_parameters.size() && k < unrefined_entries[i]->deformation_parameters.size(); ++k)
+        {
+            CHECK(refined_entries[i]->deformation_parameters[k] >= minimum);
+            CHECK(refined_entries[i]->deformation_parameters[k] <= maximum);
+            CHECK(unrefined_entries[i]->deformation_parameters[k] <= initial[k]);
+        }
+    }
+    CHECK(same_deformation_parameters(refine(optimized, 1024, 8), refined));
+    CHECK(same_deformation_parameters(refine(optimized, 1, 8), optimized));
+
+    // deformation parameters of another number of sectors and orders are
+    // an error
+    deformation_parameters_t truncated = optimized;
+    truncated.pop_back();
+    bool thrown = false;
+    try
+    {
+        refine(truncated, 1024, 8);
+    }
+    catch (const std::logic_error&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    return failed_checks != 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Checks optimize_deformation_parameters() started from the result at
+ * another point ("previous"): at the same point the guesses are kept
+ * after validation, and are not added to the deformation parameter
+ * cache; guesses that cannot be used give the result of a cold start.
+ */
+
+#include "check.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+static long long file_size(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return file ? static_cast<long long>(file.tellg()) : -1;
+}
+
+int main()
+{
+    unsetenv("SECDEC_DEFORMATION_PARAMETERS_CACHE");
+
+    std::vector<package::real_t> real_parameters(package::number_of_real_parameters, 1.5);
+    const std::vector<package::complex_t> complex_parameters(package::number_of_complex_parameters, package::complex_t(1.5, 0.5));
+    const unsigned number_of_validation_presamples = 4096;
+    const unsigned number_of_presamples = 16384;
+    const auto cold_start = [&] ()
+    {
+        return package::optimize_deformation_parameters(real_parameters, complex_parameters, number_of_presamples);
+    };
+    const auto warm_start = [&] (const deformation_parameters_t& previous)
+    {
+        return package::optimize_deformation_parameters(real_parameters, complex_parameters, previous, number_of_validation_presamples, number_of_presamples);
+    };
+
+    // at the same point every guess is valid, and lowered at most
+    const deformation_parameters_t cold = cold_start();
+    const deformation_parameters_t same_point = warm_start(cold);
+    const auto cold_entries = flatten(cold);
+    const auto same_point_entries = flatten(same_point);
+    CHECK(cold_entries.size() == same_point_entries.size());
+    for (size_t i = 0; i < cold_entries.size() && i < same_point_entries.size(); ++i)
+    {
+        CHECK(same_point_entries[i]->number_of_presamples == number_of_validation_presamples);
+        CHECK(same_point_entries[i]->deformation_parameters.size() == cold_entries[i]->deformation_parameters.size());
+        for (size_t k = 0; k < same_point_entries[i]->deformation_parameters.size() && k < cold_entries[i]->deformation_parameters.size(); ++k)
+            CHECK(same_point_entries[i]->deformation_parameters[k] <= cold_entries[i]->deformation_parameters[k]);
+    }
+
+    // guesses with the wrong number of deformation parameters fall back
+    // to presampling
+    const deformation_parameters_t unusable = secdecutil::deep_apply
+    (
+        cold,
+        [] (const package::optimized_deformation_parameters_t& entry)
+        {
+            package::optimized_deformation_parameters_t guess = entry;
+            guess.deformation_parameters.push_back(1.);
+            return guess;
+        }
+    );
+    CHECK(same_deformation_parameters(warm_start(unusable), cold));
+
+    // at a point further away every sector either keeps its guess or is
+    // presampled like a cold start
+    real_parameters[0] = 7.5;
+    const deformation_parameters_t far_cold = cold_start();
+    const deformation_parameters_t far_point = warm_start(cold);
+    const auto far_cold_entries = flatten(far_cold);
+    const auto far_point_entries = flatten(far_point);
+    CHECK(far_cold_entries.size() == far_point_entries.size());
+    for (size_t i = 0; i < far_cold_entries.size() && i < far_point_entries.size(); ++i)
+    {
+        bool same = far_point_entries[i]->number_of_presamples == far_cold_entries[i]->number_of_presamples &&
+                    far_point_entries[i]->deformation_parameters.size() == far_cold_entries[i]->deformation_parameters.size();
+        for (size_t k = 0; same && k < far_point_entries[i]->deformation_parameters.size(); ++k)
+            same = same_bits(far_point_entries[i]->deformation_parameters[k], far_cold_entries[i]->deformation_parameters[k]);
+        CHECK(same || far_point_entries[i]->number_of_presamples == number_of_validation_presamples);
+    }
+
+    // a previous result of another number of sectors and orders is an error
+    deformation_parameters_t truncated = cold;
+    truncated.pop_back();
+    bool thrown = false;
+    try
+    {
+        warm_start(truncated);
+    }
+    catch (const std::logic_error&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // kept guesses are not cached, presampled results are
+    char directory[] = "/tmp/secdec_cache_XXXXXX";
+    if (!mkdtemp(directory))
+    {
+        std::perror("mkdtemp");
+        return 1;
+    }
+    setenv("SECDEC_DEFORMATION_PARAMETERS_CACHE", directory, 1);
+    const std::string filename = std::string(directory) + "/" + package::package_name + ".deformation_parameters";
+    real_parameters[0] = 1.5;
+    warm_start(cold);
+    CHECK(file_size(filename) == -1);
+    warm_start(unusable);
+    CHECK(file_size(filename) > 0);
+    CHECK(same_deformation_parameters(cold_start(), cold));
+
+    unlink(filename.c_str());
+    rmdir(directory);
+    return failed_checks != 0;
+}
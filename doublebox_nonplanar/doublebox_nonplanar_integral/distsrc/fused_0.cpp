@@ -0,0 +1,147 @@
+#define SECDEC_RESULT_IS_COMPLEX 1
+#include "simd_cpu.h"
+
+#ifndef SECDEC_DISPATCH
+
+typedef int block_kernel_t(
+    result_t * restrict presult,
+    resultvec_t * restrict pacc,
+    const realvec_t * restrict xs,
+    const realvec_t * restrict ws,
+    const uint64_t nblock,
+    const uint64_t index,
+    const uint64_t index2,
+    const real_t * restrict realp,
+    const complex_t * restrict complexp,
+    const real_t * restrict deformp
+);
+
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_1_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_2_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_3_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_4_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_5_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_6_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_7_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_8_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_9_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_10_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_11_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_12_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_13_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_14_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_15_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_16_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_17_order_0__block);
+extern "C" block_kernel_t SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_18_order_0__block);
+
+static block_kernel_t * const block_kernels[18] = {
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_1_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_2_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_3_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_4_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_5_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_6_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_7_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_8_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_9_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_10_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_11_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_12_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_13_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_14_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_15_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_16_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_17_order_0__block),
+    SECDEC_ISA_NAME(doublebox_nonplanar_integral__sector_18_order_0__block),
+};
+
+/*
+ * presult[0..18) receives the result of each sector, in the
+ * order of block_kernels, and presult[18] their sum; deformp
+ * holds 6 deformation parameters per sector, in the same order.
+ * A sector whose sign check fails is not evaluated any further
+ * and its result is NaN; the status of the first such sector is
+ * returned.
+ */
+extern "C" int
+SECDEC_ISA_NAME(doublebox_nonplanar_integral__fused_order_0)(
+    result_t * restrict presult,
+    const uint64_t lattice,
+    const uint64_t index1,
+    const uint64_t index2,
+    const uint64_t * restrict genvec,
+    const real_t * restrict shift,
+    const real_t * restrict realp,
+    const complex_t * restrict complexp,
+    const real_t * restrict deformp
+)
+{
+    const real_t invlattice = SecDecInternalDenominator((real_t)(double)lattice);
+    realvec_t xs[6*SECDEC_FUSED_BLOCK];
+    realvec_t ws[SECDEC_FUSED_BLOCK];
+    resultvec_t acc[18];
+    pairwise_sum_t accsum[18];
+    int status[18];
+    for (int s = 0; s < 18; s++) {
+        acc[s] = RESULTVEC_ZERO;
+        pairwise_init(accsum[s]);
+        status[s] = 0;
+    }
+    uint64_t index = index1;
+    lattice_iter_t li_x0 = lattice_start(genvec[0], index, lattice, invlattice);
+    lattice_iter_t li_x1 = lattice_start(genvec[1], index, lattice, invlattice);
+    lattice_iter_t li_x2 = lattice_start(genvec[2], index, lattice, invlattice);
+    lattice_iter_t li_x3 = lattice_start(genvec[3], index, lattice, invlattice);
+    lattice_iter_t li_x4 = lattice_start(genvec[4], index, lattice, invlattice);
+    lattice_iter_t li_x5 = lattice_start(genvec[5], index, lattice, invlattice);
+    while (index < index2) {
+        const uint64_t block_index = index;
+        uint64_t nblock = 0;
+        for (; nblock < SECDEC_FUSED_BLOCK && index < index2; nblock++, index += REALVEC_SIZE) {
+            realvec_t x0 = lattice_coordinates(li_x0, invlattice, shift[0]);
+            realvec_t x1 = lattice_coordinates(li_x1, invlattice, shift[1]);
+            realvec_t x2 = lattice_coordinates(li_x2, invlattice, shift[2]);
+            realvec_t x3 = lattice_coordinates(li_x3, invlattice, shift[3]);
+            realvec_t x4 = lattice_coordinates(li_x4, invlattice, shift[4]);
+            realvec_t x5 = lattice_coordinates(li_x5, invlattice, shift[5]);
+            auto w_x0 = korobov3x3_w(x0);
+            auto w_x1 = korobov3x3_w(x1);
+            auto w_x2 = korobov3x3_w(x2);
+            auto w_x3 = korobov3x3_w(x3);
+            auto w_x4 = korobov3x3_w(x4);
+            auto w_x5 = korobov3x3_w(x5);
+            realvec_t w = w_x0*w_x1*w_x2*w_x3*w_x4*w_x5;
+            ws[nblock] = mask_tail(w, index, index2);
+            xs[0*SECDEC_FUSED_BLOCK + nblock] = korobov3x3_f(x0);
+            xs[1*SECDEC_FUSED_BLOCK + nblock] = korobov3x3_f(x1);
+            xs[2*SECDEC_FUSED_BLOCK + nblock] = korobov3x3_f(x2);
+            xs[3*SECDEC_FUSED_BLOCK + nblock] = korobov3x3_f(x3);
+            xs[4*SECDEC_FUSED_BLOCK + nblock] = korobov3x3_f(x4);
+            xs[5*SECDEC_FUSED_BLOCK + nblock] = korobov3x3_f(x5);
+        }
+        for (int s = 0; s < 18; s++) {
+            if (status[s] != 0) continue;
+            status[s] = block_kernels[s](&presult[s], &acc[s], xs, ws, nblock, block_index, index2, realp, complexp, deformp + 6*s);
+            if ((accsum[s].nvectors += nblock) >= SECDEC_SUM_BLOCK) pairwise_push(accsum[s], acc[s]);
+        }
+    }
+    int result = 0;
+    presult[18] = 0;
+    for (int s = 0; s < 18; s++) {
+        if (status[s] == 0) presult[s] = componentsum(pairwise_total(accsum[s], acc[s]));
+        else if (result == 0) result = status[s];
+        presult[18] = presult[18] + presult[s];
+    }
+    return result;
+}
+
+#else
+
+#include "simd_dispatch.h"
+
+SECDEC_DISPATCH_KERNEL(int, doublebox_nonplanar_integral__fused_order_0,
+    (result_t * restrict presult, const uint64_t lattice, const uint64_t index1, const uint64_t index2, const uint64_t * restrict genvec, const real_t * restrict shift, const real_t * restrict realp, const complex_t * restrict complexp, const real_t * restrict deformp),
+    (presult, lattice, index1, index2, genvec, shift, realp, complexp, deformp))
+
+#endif
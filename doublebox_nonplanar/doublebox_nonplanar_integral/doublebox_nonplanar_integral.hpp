@@ -6,6 +6,7 @@
 #else
     #include <complex>
 #endif
+#include <functional>
 #include <string>
 #include <vector>
 #include <secdecutil/integrand_container.hpp>
@@ -44,6 +45,31 @@ namespace doublebox_nonplanar_integral
     #endif
     template<typename T> using nested_series_t = secdecutil::Series<T>;
     typedef secdecutil::IntegrandContainer<integrand_return_t, real_t const * const, real_t> integrand_t;
+    // "count" points at once, integration variable k of point i at
+    // integration_variables[k*count + i], written to results[i]
+    #if doublebox_nonplanar_integral_contour_deformation
+        typedef void batch_integrand_t(unsigned long long count, real_t const * integration_variables, real_t const * real_parameters, complex_t const * complex_parameters, real_t const * deformation_parameters, secdecutil::ResultInfo * result_info, integrand_return_t * results);
+        // the integrand, also storing the imaginary part of the deformed F
+        // polynomial and the real part of the positive polynomial its sign
+        // checks compare to zero
+        typedef integrand_return_t checked_integrand_t(real_t const * integration_variables, real_t const * real_parameters, complex_t const * complex_parameters, real_t const * deformation_parameters, secdecutil::ResultInfo * result_info, real_t * contour_deformation_check, real_t * positive_polynomial_check);
+        // the contour deformation polynomial in two steps: the first stores
+        // what does not depend on the deformation parameters for one point
+        // in "prefix", the second finishes from there for some deformation
+        // parameters
+        typedef void contour_deformation_prefix_function_t(real_t const * integration_variables, real_t const * real_parameters, complex_t const * complex_parameters, real_t * prefix);
+        typedef integrand_return_t prefixed_contour_deformation_polynomial_t(real_t const * prefix, real_t const * real_parameters, complex_t const * complex_parameters, real_t const * deformation_parameters, secdecutil::ResultInfo * result_info);
+        struct contour_deformation_prefix_t
+        {
+            unsigned number_of_integration_variables;
+            unsigned prefix_size;
+            contour_deformation_prefix_function_t * prefix;
+            prefixed_contour_deformation_polynomial_t * polynomial;
+            secdecutil::SectorContainerWithDeformation<real_t,complex_t>::MaximalDeformationFunction * maximal_allowed_deformation_parameters;
+        };
+    #else
+        typedef void batch_integrand_t(unsigned long long count, real_t const * integration_variables, real_t const * real_parameters, complex_t const * complex_parameters, secdecutil::ResultInfo * result_info, integrand_return_t * results);
+    #endif
     // --}
 
     const std::string package_name = "doublebox_nonplanar_integral";
@@ -68,10 +94,118 @@ namespace doublebox_nonplanar_integral
     const std::vector<int> requested_orders = {0};
 
     const std::vector<nested_series_t<sector_container_t>>& get_sectors();
+    #ifndef SECDEC_WITH_CUDA
+        // the batched integrands of the sectors, in the order of get_sectors();
+        // make_integrands and the integrators of secdecutil do not use them,
+        // as those evaluate an integrand_t one point at a time
+        const std::vector<nested_series_t<batch_integrand_t*>>& get_batch_integrands();
+        #if doublebox_nonplanar_integral_contour_deformation
+            const std::vector<nested_series_t<checked_integrand_t*>>& get_checked_integrands();
+            const std::vector<nested_series_t<contour_deformation_prefix_t>>& get_contour_deformation_prefixes();
+            // the sectors of get_sectors() with "presampled_deformation_
+            // parameters" as their maximal deformation parameters
+            const std::vector<nested_series_t<sector_container_t>>& get_presampled_sectors();
+
+            // the deformation parameters of a sector and order, and the
+            // number of points presampling used for them
+            struct optimized_deformation_parameters_t
+            {
+                std::vector<real_t> deformation_parameters;
+                unsigned number_of_presamples;
+            };
+
+            // the deformation parameters of every sector and order, found
+            // like "make_integrands" does: the largest ones allowed at the
+            // presampling points, capped at the maximum, then reduced by the
+            // decrease factor until the sign check of the contour deformation
+            // polynomial passes at all of these points, and then until the
+            // integrand passes the sign checks of the integration (those of
+            // get_checked_integrands()) there too; the sectors are presampled
+            // in parallel
+            // The points are added in stages, "number_of_initial_presamples"
+            // first and four times as many in every further stage, up to
+            // "number_of_presamples"; presampling stops early once a stage no
+            // longer lowers any deformation parameter by more than the
+            // relative "presampling_tolerance".
+            // If the environment variable SECDEC_DEFORMATION_PARAMETERS_CACHE
+            // names a directory, the results are cached in a file per package
+            // there, keyed by the package, its generated code, the sector and
+            // order, the parameters and the presampling settings.
+            std::vector<nested_series_t<optimized_deformation_parameters_t>> optimize_deformation_parameters
+            (
+                const std::vector<real_t>& real_parameters,
+                const std::vector<complex_t>& complex_parameters,
+                unsigned number_of_presamples = 100000,
+                real_t deformation_parameters_maximum = 1.,
+                real_t deformation_parameters_minimum = 1.e-5,
+                real_t deformation_parameters_decrease_factor = 0.9,
+                unsigned number_of_initial_presamples = 4096,
+                real_t presampling_tolerance = 0.05
+            );
+
+            // as above, but first trying the deformation parameters of the
+            // sectors and orders from "previous", typically the result at a
+            // neighbouring point of a scan: lowered to the largest ones
+            // allowed at "number_of_validation_presamples" points, they are
+            // kept if the integrand passes the sign checks of the integration
+            // at all of them, and reported with this number of
+            // presamples; otherwise the sector is presampled as usual
+            std::vector<nested_series_t<optimized_deformation_parameters_t>> optimize_deformation_parameters
+            (
+                const std::vector<real_t>& real_parameters,
+                const std::vector<complex_t>& complex_parameters,
+                const std::vector<nested_series_t<optimized_deformation_parameters_t>>& previous,
+                unsigned number_of_validation_presamples = 4096,
+                unsigned number_of_presamples = 100000,
+                real_t deformation_parameters_maximum = 1.,
+                real_t deformation_parameters_minimum = 1.e-5,
+                real_t deformation_parameters_decrease_factor = 0.9,
+                unsigned number_of_initial_presamples = 4096,
+                real_t presampling_tolerance = 0.05
+            );
+
+            // refines the deformation parameters of every sector and order
+            // in "optimized" one variable at a time, to lower the variance of
+            // the integrand: every sweep over the variables keeps the first
+            // step by the decrease factor, up (to the largest deformation
+            // parameters allowed at the samples) or down, that lowers its
+            // sample variance at "number_of_samples" points without failing
+            // a sign check there; at most "number_of_rounds" sweeps
+            // make_integrands does not refine; to integrate with refined
+            // deformation parameters, pass them as "previous" to the
+            // make_integrands below, which keeps those that pass its
+            // validation
+            std::vector<nested_series_t<optimized_deformation_parameters_t>> refine_deformation_parameters
+            (
+                const std::vector<real_t>& real_parameters,
+                const std::vector<complex_t>& complex_parameters,
+                const std::vector<nested_series_t<optimized_deformation_parameters_t>>& optimized,
+                unsigned number_of_samples = 1024,
+                unsigned number_of_rounds = 8,
+                real_t deformation_parameters_maximum = 1.,
+                real_t deformation_parameters_minimum = 1.e-5,
+                real_t deformation_parameters_decrease_factor = 0.9
+            );
+
+            // reports the deformation parameters set with use_presampled_
+            // deformation_parameters() in the calling thread, whatever the
+            // point
+            secdecutil::SectorContainerWithDeformation<real_t,complex_t>::MaximalDeformationFunction presampled_deformation_parameters;
+            void use_presampled_deformation_parameters(const std::vector<real_t>& deformation_parameters);
+        #endif
+    #endif
+    // calls body(i) for every i < count on up to "number_of_threads"
+    // threads (std::thread::hardware_concurrency() for 0) and rethrows
+    // the first exception of any call once all of them have returned
+    void for_each_in_parallel(unsigned long long count, const std::function<void(unsigned long long)>& body, unsigned number_of_threads = 0);
     nested_series_t<integrand_return_t> prefactor(const std::vector<real_t>& real_parameters, const std::vector<complex_t>& complex_parameters);
 
     extern const std::vector<std::vector<real_t>> pole_structures;
 
+    // With a contour deformation, the deformation parameters are those
+    // of optimize_deformation_parameters() with its default stages:
+    // "number_of_presamples" is the most points presampled, and a sector
+    // stops earlier once its deformation parameters settle.
     std::vector<nested_series_t<integrand_t>> make_integrands
     (
         const std::vector<real_t>& real_parameters,
@@ -84,6 +218,26 @@ namespace doublebox_nonplanar_integral
         #endif
     );
 
+    #ifndef SECDEC_WITH_CUDA
+        #if doublebox_nonplanar_integral_contour_deformation
+            // make_integrands with the deformation parameters of
+            // optimize_deformation_parameters(..., previous, ...): a sector
+            // whose guess is kept is only sign-checked at the
+            // "number_of_validation_presamples" points
+            std::vector<nested_series_t<integrand_t>> make_integrands
+            (
+                const std::vector<real_t>& real_parameters,
+                const std::vector<complex_t>& complex_parameters,
+                const std::vector<nested_series_t<optimized_deformation_parameters_t>>& previous,
+                unsigned number_of_validation_presamples = 4096,
+                unsigned number_of_presamples = 100000,
+                real_t deformation_parameters_maximum = 1.,
+                real_t deformation_parameters_minimum = 1.e-5,
+                real_t deformation_parameters_decrease_factor = 0.9
+            );
+        #endif
+    #endif
+
     #ifdef SECDEC_WITH_CUDA
         #if doublebox_nonplanar_integral_contour_deformation
             typedef secdecutil::CudaIntegrandContainerWithDeformation
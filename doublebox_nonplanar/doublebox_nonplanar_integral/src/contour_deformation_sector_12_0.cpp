@@ -30,6 +30,11 @@ integrand_return_t sector_12_order_0_contour_deformation_polynomial
     const auto SecDecInternalLambda3 = deformation_parameters[3]; (void)SecDecInternalLambda3;
     const auto SecDecInternalLambda4 = deformation_parameters[4]; (void)SecDecInternalLambda4;
     const auto SecDecInternalLambda5 = deformation_parameters[5]; (void)SecDecInternalLambda5;
+    auto tmp3_68 = 2*msq;
+    auto tmp3_69 = tmp3_68-t;
+    auto tmp3_70 = 3*msq;
+    auto tmp3_71 = tmp3_70-t;
+    auto tmp3_72 = -s + tmp3_70;
     auto tmp1_1 = x1 + 2;
     auto tmp3_1 = tmp1_1*x1;
     auto tmp3_2 = tmp3_1 + 1;
@@ -37,31 +42,140 @@ integrand_return_t sector_12_order_0_contour_deformation_polynomial
     auto tmp1_3 = x3 + 2*tmp1_2;
     auto tmp1_4 = tmp1_3*x3;
     auto tmp3_3 = tmp1_4 + tmp3_2;
+    auto tmp1_8 = x0 + 1;
+    auto tmp1_9 = tmp1_8 + x4;
+    auto tmp3_17 = tmp1_9*tmp3_2;
+    auto tmp3_18 = x3*tmp1_9*tmp1_3;
     auto tmp1_5 = tmp1_2 + x3;
+    auto tmp3_19 = tmp1_5*tmp1_9;
+    auto tmp3_20 = 3*tmp3_19;
+    auto tmp3_21 = tmp1_9*x2;
+    auto tmp1_15 = tmp3_20 + tmp3_21;
+    auto tmp3_22 = x2*tmp1_15;
+    auto tmp1_16 = x2*tmp1_5;
+    auto tmp3_23 = tmp1_16 + tmp3_3;
+    auto tmp1_17 = x5*x2;
+    auto tmp1_18 = 2*tmp1_17;
+    auto tmp3_24 = tmp3_23*tmp1_18;
+    auto tmp3_25 = tmp3_24 + tmp3_22 + tmp3_18 + tmp3_17;
+    auto tmp3_10 = x3*t;
+    auto tmp1_10 = x1*s;
+    auto tmp3_31 = tmp1_10*x0;
+    auto tmp3_32 = tmp3_10*x4;
+    auto tmp3_33 = t + tmp3_31 + tmp3_32;
+    auto tmp3_26 = msq*tmp3_25;
+    auto tmp3_27 = -t*tmp1_8;
+    auto tmp3_28 = x4*t;
+    auto tmp3_29 = -tmp3_28 + tmp3_27;
+    auto tmp3_30 = x3*tmp3_29;
+    auto tmp3_35 = -tmp3_10*tmp1_18;
+    auto tmp3_34 = -x2*tmp3_33;
+    auto tmp3_36 = tmp3_26 + tmp3_35 + tmp3_30 + tmp3_34;
+    auto tmp3_37 = 2*tmp1_5;
+    auto tmp3_38 = x2*tmp3_37;
+    auto tmp3_39 = tmp3_38 + tmp3_3;
+    auto tmp3_40 = x5*tmp3_39;
+    auto tmp3_41 = tmp3_40 + tmp3_20 + 2*tmp3_21;
+    auto tmp3_53 = tmp3_37 + x2;
+    auto tmp3_54 = tmp3_53*tmp1_17;
+    auto tmp3_55 = 3*tmp3_21 + tmp3_54 + 2*tmp3_19;
     auto tmp1_6 = x2 + 3*tmp1_5;
     auto tmp3_4 = tmp1_6*x2;
     auto tmp3_5 = tmp3_4 + tmp3_3;
-    auto tmp3_6 = tmp3_5*x5;
     auto tmp1_7 = tmp1_5 + x2;
-    auto tmp1_8 = x0 + 1;
-    auto tmp1_9 = tmp1_8 + x4;
     auto tmp3_7 = tmp1_7*tmp1_9;
+    auto tmp3_6 = tmp3_5*x5;
     auto tmp3_8 = tmp3_6 + 2*tmp3_7;
     auto tmp3_9 = tmp3_8*msq;
-    auto tmp3_10 = x3*t;
-    auto tmp1_10 = x1*s;
-    auto tmp1_11 = -x2*tmp1_10;
-    auto tmp3_11 = -tmp3_10 + tmp1_11;
-    auto tmp3_12 = x5*tmp3_11;
-    auto tmp3_13 = tmp3_12 + tmp3_9;
+    auto tmp3_14 = tmp1_2 + x2;
+    auto tmp3_15 = -t*tmp3_14;
     auto tmp1_12 = tmp3_10*x5;
     auto tmp1_13 = x2 + 1;
     auto tmp1_14 = -tmp1_13*tmp1_12;
-    auto tmp3_14 = tmp1_2 + x2;
-    auto tmp3_15 = -t*tmp3_14;
     auto tmp3_16 = tmp3_9 + tmp1_14-tmp3_10 + tmp3_15;
+    auto tmp1_11 = -x2*tmp1_10;
+    auto tmp3_11 = -tmp3_10 + tmp1_11;
+    auto tmp3_12 = x5*tmp3_11;
+    auto tmp3_13 = tmp3_12 + tmp3_9;
+    auto tmp3_43 = x4 + 2*tmp1_8;
+    auto tmp3_44 = tmp3_43*x4;
+    auto tmp3_45 = x0 + 2;
+    auto tmp3_46 = tmp3_45*x0;
+    auto tmp3_47 = tmp3_44 + tmp3_46 + 1;
+    auto tmp3_50 = -tmp1_12-tmp3_33;
+    auto tmp3_42 = x5*tmp3_41;
+    auto tmp3_48 = tmp3_42 + tmp3_47;
+    auto tmp3_49 = msq*tmp3_48;
+    auto tmp3_51 = x5*tmp3_50;
+    auto tmp3_52 = tmp3_49-tmp3_28 + tmp3_51;
+    auto tmp3_56 = tmp3_55*x5;
+    auto tmp3_57 = tmp3_56 + tmp3_47;
+    auto tmp3_58 = tmp3_57*msq;
+    auto tmp3_59 = tmp3_58-tmp3_28;
+    auto tmp3_62 = -tmp3_28*tmp1_13;
+    auto tmp3_63 = -tmp1_17-tmp1_8;
+    auto tmp3_64 = t*tmp3_63;
+    auto tmp3_65 = tmp3_64 + tmp3_62;
+    auto tmp3_60 = -tmp1_17*x0*s;
+    auto tmp3_61 = tmp3_60 + tmp3_59;
+    auto tmp3_66 = x5*tmp3_65;
+    auto tmp3_67 = tmp3_66 + tmp3_59;
+    auto tmp3_73 = -1 + x0;
+    auto tmp3_74 = x0*SecDecInternalLambda0*tmp3_73;
+    auto tmp3_75 = -1 + x4;
+    auto tmp3_76 = x4*SecDecInternalLambda4*tmp3_75;
+    auto tmp3_77 = -1 + x5;
+    auto tmp3_78 = x5*SecDecInternalLambda5*tmp3_77;
+    auto tmp3_79 = -1 + x2;
+    auto tmp3_80 = x2*SecDecInternalLambda2*tmp3_79;
+    auto tmp3_81 = -1 + x1;
+    auto tmp3_82 = x1*SecDecInternalLambda1*tmp3_81;
+    auto tmp3_83 = -1 + x3;
+    auto tmp3_84 = x3*SecDecInternalLambda3*tmp3_83;
+    auto __RealPartCall1 = SecDecInternalRealPart(tmp3_67);
+    auto __RealPartCall2 = SecDecInternalRealPart(tmp3_61);
+    auto __RealPartCall3 = SecDecInternalRealPart(tmp3_52);
+    auto __RealPartCall4 = SecDecInternalRealPart(tmp3_36);
+    auto __RealPartCall5 = SecDecInternalRealPart(tmp3_16);
+    auto __RealPartCall6 = SecDecInternalRealPart(tmp3_13);
+    auto __Deformedx0Call = x0 + i_*__RealPartCall6*tmp3_74;
+    auto __Deformedx1Call = x1 + i_*__RealPartCall2*tmp3_82;
+    auto __Deformedx2Call = x2 + i_*__RealPartCall3*tmp3_80;
+    auto __Deformedx3Call = x3 + i_*__RealPartCall1*tmp3_84;
+    auto __Deformedx4Call = x4 + i_*__RealPartCall5*tmp3_76;
+    auto __Deformedx5Call = x5 + i_*__RealPartCall4*tmp3_78;
+    return(__Deformedx4Call*tmp3_69 + __Deformedx3Call*__Deformedx5Call*tmp3_69 + __Deformedx3Call*__Deformedx4Call*tmp3_69 + __Deformedx3Call*__Deformedx4Call*__Deformedx5Call*tmp3_69 + __Deformedx2Call*__Deformedx5Call*tmp3_71 + __Deformedx2Call*__Deformedx4Call*tmp3_69 + __Deformedx2Call*__Deformedx4Call*__Deformedx5Call*tmp3_70 + __Deformedx2Call*__Deformedx3Call*__Deformedx5Call*tmp3_70 + __Deformedx2Call*__Deformedx3Call*SecDecInternalSqr(__Deformedx5Call)*tmp3_69 + __Deformedx2Call*__Deformedx3Call*__Deformedx4Call*__Deformedx5Call*tmp3_71 + __Deformedx1Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx4Call*tmp3_69 + __Deformedx1Call*__Deformedx4Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx3Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx3Call*__Deformedx4Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx2Call*__Deformedx5Call*tmp3_70 + __Deformedx1Call*__Deformedx2Call*SecDecInternalSqr(__Deformedx5Call)*tmp3_68 + __Deformedx1Call*__Deformedx2Call*__Deformedx4Call*__Deformedx5Call*tmp3_70 + __Deformedx1Call*__Deformedx2Call*__Deformedx3Call*SecDecInternalSqr(__Deformedx5Call)*tmp3_68 + __Deformedx0Call*tmp3_68 + __Deformedx0Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx3Call*tmp3_68 + __Deformedx0Call*__Deformedx3Call*__Deformedx5Call*tmp3_69 + __Deformedx0Call*__Deformedx3Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx2Call*tmp3_68 + __Deformedx0Call*__Deformedx2Call*__Deformedx5Call*tmp3_70 + __Deformedx0Call*__Deformedx2Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx2Call*__Deformedx3Call*__Deformedx5Call*tmp3_70 + __Deformedx0Call*__Deformedx1Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx5Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx3Call*__Deformedx5Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx2Call*__Deformedx5Call*tmp3_72 + msq + msq*__Deformedx5Call + msq*__Deformedx4Call*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx4Call)+msq*__Deformedx3Call + msq*__Deformedx3Call*SecDecInternalSqr(__Deformedx4Call)+msq*SecDecInternalSqr(__Deformedx3Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx3Call)*__Deformedx4Call*__Deformedx5Call + msq*__Deformedx2Call + msq*__Deformedx2Call*SecDecInternalSqr(__Deformedx5Call)+msq*__Deformedx2Call*SecDecInternalSqr(__Deformedx4Call)+msq*__Deformedx2Call*SecDecInternalSqr(__Deformedx3Call)*SecDecInternalSqr(__Deformedx5Call)+msq*SecDecInternalSqr(__Deformedx2Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx2Call)*SecDecInternalSqr(__Deformedx5Call)+msq*SecDecInternalSqr(__Deformedx2Call)*__Deformedx4Call*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx2Call)*__Deformedx3Call*SecDecInternalSqr(__Deformedx5Call)+msq*__Deformedx1Call + msq*__Deformedx1Call*SecDecInternalSqr(__Deformedx4Call)+msq*__Deformedx1Call*SecDecInternalSqr(__Deformedx2Call)*SecDecInternalSqr(__Deformedx5Call)+msq*SecDecInternalSqr(__Deformedx1Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx1Call)*__Deformedx4Call*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx1Call)*__Deformedx2Call*SecDecInternalSqr(__Deformedx5Call)+msq*__Deformedx0Call*__Deformedx5Call + msq*__Deformedx0Call*SecDecInternalSqr(__Deformedx3Call)*__Deformedx5Call + msq*__Deformedx0Call*SecDecInternalSqr(__Deformedx2Call)*__Deformedx5Call + msq*__Deformedx0Call*SecDecInternalSqr(__Deformedx1Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx0Call)+msq*SecDecInternalSqr(__Deformedx0Call)*__Deformedx3Call + msq*SecDecInternalSqr(__Deformedx0Call)*__Deformedx2Call + msq*SecDecInternalSqr(__Deformedx0Call)*__Deformedx1Call);
+}
+#ifndef SECDEC_WITH_CUDA
+void sector_12_order_0_contour_deformation_polynomial_prefix
+(
+    real_t const * restrict const integration_variables,
+    real_t const * restrict const real_parameters,
+    complex_t const * restrict const complex_parameters,
+    real_t * restrict const prefix
+)
+{
+    const auto x0 = integration_variables[0]; (void)x0;
+    const auto x1 = integration_variables[1]; (void)x1;
+    const auto x2 = integration_variables[2]; (void)x2;
+    const auto x3 = integration_variables[3]; (void)x3;
+    const auto x4 = integration_variables[4]; (void)x4;
+    const auto x5 = integration_variables[5]; (void)x5;
+    const auto s = real_parameters[0]; (void)s;
+    const auto t = real_parameters[1]; (void)t;
+    const auto msq = real_parameters[2]; (void)msq;
+    auto tmp1_1 = x1 + 2;
+    auto tmp3_1 = tmp1_1*x1;
+    auto tmp3_2 = tmp3_1 + 1;
+    auto tmp1_2 = x1 + 1;
+    auto tmp1_3 = x3 + 2*tmp1_2;
+    auto tmp1_4 = tmp1_3*x3;
+    auto tmp3_3 = tmp1_4 + tmp3_2;
+    auto tmp1_8 = x0 + 1;
+    auto tmp1_9 = tmp1_8 + x4;
     auto tmp3_17 = tmp1_9*tmp3_2;
     auto tmp3_18 = x3*tmp1_9*tmp1_3;
+    auto tmp1_5 = tmp1_2 + x3;
     auto tmp3_19 = tmp1_5*tmp1_9;
     auto tmp3_20 = 3*tmp3_19;
     auto tmp3_21 = tmp1_9*x2;
@@ -73,71 +187,146 @@ integrand_return_t sector_12_order_0_contour_deformation_polynomial
     auto tmp1_18 = 2*tmp1_17;
     auto tmp3_24 = tmp3_23*tmp1_18;
     auto tmp3_25 = tmp3_24 + tmp3_22 + tmp3_18 + tmp3_17;
+    auto tmp3_10 = x3*t;
+    auto tmp1_10 = x1*s;
+    auto tmp3_31 = tmp1_10*x0;
+    auto tmp3_32 = tmp3_10*x4;
+    auto tmp3_33 = t + tmp3_31 + tmp3_32;
     auto tmp3_26 = msq*tmp3_25;
     auto tmp3_27 = -t*tmp1_8;
     auto tmp3_28 = x4*t;
     auto tmp3_29 = -tmp3_28 + tmp3_27;
     auto tmp3_30 = x3*tmp3_29;
-    auto tmp3_31 = tmp1_10*x0;
-    auto tmp3_32 = tmp3_10*x4;
-    auto tmp3_33 = t + tmp3_31 + tmp3_32;
-    auto tmp3_34 = -x2*tmp3_33;
     auto tmp3_35 = -tmp3_10*tmp1_18;
+    auto tmp3_34 = -x2*tmp3_33;
     auto tmp3_36 = tmp3_26 + tmp3_35 + tmp3_30 + tmp3_34;
     auto tmp3_37 = 2*tmp1_5;
     auto tmp3_38 = x2*tmp3_37;
     auto tmp3_39 = tmp3_38 + tmp3_3;
     auto tmp3_40 = x5*tmp3_39;
     auto tmp3_41 = tmp3_40 + tmp3_20 + 2*tmp3_21;
-    auto tmp3_42 = x5*tmp3_41;
+    auto tmp3_53 = tmp3_37 + x2;
+    auto tmp3_54 = tmp3_53*tmp1_17;
+    auto tmp3_55 = 3*tmp3_21 + tmp3_54 + 2*tmp3_19;
+    auto tmp1_6 = x2 + 3*tmp1_5;
+    auto tmp3_4 = tmp1_6*x2;
+    auto tmp3_5 = tmp3_4 + tmp3_3;
+    auto tmp1_7 = tmp1_5 + x2;
+    auto tmp3_7 = tmp1_7*tmp1_9;
+    auto tmp3_6 = tmp3_5*x5;
+    auto tmp3_8 = tmp3_6 + 2*tmp3_7;
+    auto tmp3_9 = tmp3_8*msq;
+    auto tmp3_14 = tmp1_2 + x2;
+    auto tmp3_15 = -t*tmp3_14;
+    auto tmp1_12 = tmp3_10*x5;
+    auto tmp1_13 = x2 + 1;
+    auto tmp1_14 = -tmp1_13*tmp1_12;
+    auto tmp3_16 = tmp3_9 + tmp1_14-tmp3_10 + tmp3_15;
+    auto tmp1_11 = -x2*tmp1_10;
+    auto tmp3_11 = -tmp3_10 + tmp1_11;
+    auto tmp3_12 = x5*tmp3_11;
+    auto tmp3_13 = tmp3_12 + tmp3_9;
     auto tmp3_43 = x4 + 2*tmp1_8;
     auto tmp3_44 = tmp3_43*x4;
     auto tmp3_45 = x0 + 2;
     auto tmp3_46 = tmp3_45*x0;
     auto tmp3_47 = tmp3_44 + tmp3_46 + 1;
+    auto tmp3_50 = -tmp1_12-tmp3_33;
+    auto tmp3_42 = x5*tmp3_41;
     auto tmp3_48 = tmp3_42 + tmp3_47;
     auto tmp3_49 = msq*tmp3_48;
-    auto tmp3_50 = -tmp1_12-tmp3_33;
     auto tmp3_51 = x5*tmp3_50;
     auto tmp3_52 = tmp3_49-tmp3_28 + tmp3_51;
-    auto tmp3_53 = tmp3_37 + x2;
-    auto tmp3_54 = tmp3_53*tmp1_17;
-    auto tmp3_55 = 3*tmp3_21 + tmp3_54 + 2*tmp3_19;
     auto tmp3_56 = tmp3_55*x5;
     auto tmp3_57 = tmp3_56 + tmp3_47;
     auto tmp3_58 = tmp3_57*msq;
     auto tmp3_59 = tmp3_58-tmp3_28;
-    auto tmp3_60 = -tmp1_17*x0*s;
-    auto tmp3_61 = tmp3_60 + tmp3_59;
     auto tmp3_62 = -tmp3_28*tmp1_13;
     auto tmp3_63 = -tmp1_17-tmp1_8;
     auto tmp3_64 = t*tmp3_63;
     auto tmp3_65 = tmp3_64 + tmp3_62;
+    auto tmp3_60 = -tmp1_17*x0*s;
+    auto tmp3_61 = tmp3_60 + tmp3_59;
     auto tmp3_66 = x5*tmp3_65;
     auto tmp3_67 = tmp3_66 + tmp3_59;
-    auto tmp3_68 = 2*msq;
-    auto tmp3_69 = tmp3_68-t;
-    auto tmp3_70 = 3*msq;
-    auto tmp3_71 = tmp3_70-t;
-    auto tmp3_72 = -s + tmp3_70;
     auto tmp3_73 = -1 + x0;
-    auto tmp3_74 = x0*SecDecInternalLambda0*tmp3_73;
     auto tmp3_75 = -1 + x4;
-    auto tmp3_76 = x4*SecDecInternalLambda4*tmp3_75;
     auto tmp3_77 = -1 + x5;
-    auto tmp3_78 = x5*SecDecInternalLambda5*tmp3_77;
     auto tmp3_79 = -1 + x2;
-    auto tmp3_80 = x2*SecDecInternalLambda2*tmp3_79;
     auto tmp3_81 = -1 + x1;
-    auto tmp3_82 = x1*SecDecInternalLambda1*tmp3_81;
     auto tmp3_83 = -1 + x3;
-    auto tmp3_84 = x3*SecDecInternalLambda3*tmp3_83;
     auto __RealPartCall1 = SecDecInternalRealPart(tmp3_67);
     auto __RealPartCall2 = SecDecInternalRealPart(tmp3_61);
     auto __RealPartCall3 = SecDecInternalRealPart(tmp3_52);
     auto __RealPartCall4 = SecDecInternalRealPart(tmp3_36);
     auto __RealPartCall5 = SecDecInternalRealPart(tmp3_16);
     auto __RealPartCall6 = SecDecInternalRealPart(tmp3_13);
+    prefix[0] = x0;
+    prefix[1] = x1;
+    prefix[2] = x2;
+    prefix[3] = x3;
+    prefix[4] = x4;
+    prefix[5] = x5;
+    prefix[6] = tmp3_73;
+    prefix[7] = tmp3_75;
+    prefix[8] = tmp3_77;
+    prefix[9] = tmp3_79;
+    prefix[10] = tmp3_81;
+    prefix[11] = tmp3_83;
+    prefix[12] = __RealPartCall1;
+    prefix[13] = __RealPartCall2;
+    prefix[14] = __RealPartCall3;
+    prefix[15] = __RealPartCall4;
+    prefix[16] = __RealPartCall5;
+    prefix[17] = __RealPartCall6;
+}
+integrand_return_t sector_12_order_0_contour_deformation_polynomial_from_prefix
+(
+    real_t const * restrict const prefix,
+    real_t const * restrict const real_parameters,
+    complex_t const * restrict const complex_parameters,
+    real_t const * restrict const deformation_parameters,
+    secdecutil::ResultInfo * restrict const result_info
+)
+{
+    const auto s = real_parameters[0]; (void)s;
+    const auto t = real_parameters[1]; (void)t;
+    const auto msq = real_parameters[2]; (void)msq;
+    const auto SecDecInternalLambda0 = deformation_parameters[0]; (void)SecDecInternalLambda0;
+    const auto SecDecInternalLambda1 = deformation_parameters[1]; (void)SecDecInternalLambda1;
+    const auto SecDecInternalLambda2 = deformation_parameters[2]; (void)SecDecInternalLambda2;
+    const auto SecDecInternalLambda3 = deformation_parameters[3]; (void)SecDecInternalLambda3;
+    const auto SecDecInternalLambda4 = deformation_parameters[4]; (void)SecDecInternalLambda4;
+    const auto SecDecInternalLambda5 = deformation_parameters[5]; (void)SecDecInternalLambda5;
+    auto tmp3_68 = 2*msq;
+    auto tmp3_69 = tmp3_68-t;
+    auto tmp3_70 = 3*msq;
+    auto tmp3_71 = tmp3_70-t;
+    auto tmp3_72 = -s + tmp3_70;
+    const auto x0 = prefix[0]; (void)x0;
+    const auto x1 = prefix[1]; (void)x1;
+    const auto x2 = prefix[2]; (void)x2;
+    const auto x3 = prefix[3]; (void)x3;
+    const auto x4 = prefix[4]; (void)x4;
+    const auto x5 = prefix[5]; (void)x5;
+    const auto tmp3_73 = prefix[6]; (void)tmp3_73;
+    const auto tmp3_75 = prefix[7]; (void)tmp3_75;
+    const auto tmp3_77 = prefix[8]; (void)tmp3_77;
+    const auto tmp3_79 = prefix[9]; (void)tmp3_79;
+    const auto tmp3_81 = prefix[10]; (void)tmp3_81;
+    const auto tmp3_83 = prefix[11]; (void)tmp3_83;
+    const auto __RealPartCall1 = prefix[12]; (void)__RealPartCall1;
+    const auto __RealPartCall2 = prefix[13]; (void)__RealPartCall2;
+    const auto __RealPartCall3 = prefix[14]; (void)__RealPartCall3;
+    const auto __RealPartCall4 = prefix[15]; (void)__RealPartCall4;
+    const auto __RealPartCall5 = prefix[16]; (void)__RealPartCall5;
+    const auto __RealPartCall6 = prefix[17]; (void)__RealPartCall6;
+    auto tmp3_74 = x0*SecDecInternalLambda0*tmp3_73;
+    auto tmp3_76 = x4*SecDecInternalLambda4*tmp3_75;
+    auto tmp3_78 = x5*SecDecInternalLambda5*tmp3_77;
+    auto tmp3_80 = x2*SecDecInternalLambda2*tmp3_79;
+    auto tmp3_82 = x1*SecDecInternalLambda1*tmp3_81;
+    auto tmp3_84 = x3*SecDecInternalLambda3*tmp3_83;
     auto __Deformedx0Call = x0 + i_*__RealPartCall6*tmp3_74;
     auto __Deformedx1Call = x1 + i_*__RealPartCall2*tmp3_82;
     auto __Deformedx2Call = x2 + i_*__RealPartCall3*tmp3_80;
@@ -146,4 +335,5 @@ integrand_return_t sector_12_order_0_contour_deformation_polynomial
     auto __Deformedx5Call = x5 + i_*__RealPartCall4*tmp3_78;
     return(__Deformedx4Call*tmp3_69 + __Deformedx3Call*__Deformedx5Call*tmp3_69 + __Deformedx3Call*__Deformedx4Call*tmp3_69 + __Deformedx3Call*__Deformedx4Call*__Deformedx5Call*tmp3_69 + __Deformedx2Call*__Deformedx5Call*tmp3_71 + __Deformedx2Call*__Deformedx4Call*tmp3_69 + __Deformedx2Call*__Deformedx4Call*__Deformedx5Call*tmp3_70 + __Deformedx2Call*__Deformedx3Call*__Deformedx5Call*tmp3_70 + __Deformedx2Call*__Deformedx3Call*SecDecInternalSqr(__Deformedx5Call)*tmp3_69 + __Deformedx2Call*__Deformedx3Call*__Deformedx4Call*__Deformedx5Call*tmp3_71 + __Deformedx1Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx4Call*tmp3_69 + __Deformedx1Call*__Deformedx4Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx3Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx3Call*__Deformedx4Call*__Deformedx5Call*tmp3_68 + __Deformedx1Call*__Deformedx2Call*__Deformedx5Call*tmp3_70 + __Deformedx1Call*__Deformedx2Call*SecDecInternalSqr(__Deformedx5Call)*tmp3_68 + __Deformedx1Call*__Deformedx2Call*__Deformedx4Call*__Deformedx5Call*tmp3_70 + __Deformedx1Call*__Deformedx2Call*__Deformedx3Call*SecDecInternalSqr(__Deformedx5Call)*tmp3_68 + __Deformedx0Call*tmp3_68 + __Deformedx0Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx3Call*tmp3_68 + __Deformedx0Call*__Deformedx3Call*__Deformedx5Call*tmp3_69 + __Deformedx0Call*__Deformedx3Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx2Call*tmp3_68 + __Deformedx0Call*__Deformedx2Call*__Deformedx5Call*tmp3_70 + __Deformedx0Call*__Deformedx2Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx2Call*__Deformedx3Call*__Deformedx5Call*tmp3_70 + __Deformedx0Call*__Deformedx1Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx5Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx4Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx3Call*__Deformedx5Call*tmp3_68 + __Deformedx0Call*__Deformedx1Call*__Deformedx2Call*__Deformedx5Call*tmp3_72 + msq + msq*__Deformedx5Call + msq*__Deformedx4Call*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx4Call)+msq*__Deformedx3Call + msq*__Deformedx3Call*SecDecInternalSqr(__Deformedx4Call)+msq*SecDecInternalSqr(__Deformedx3Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx3Call)*__Deformedx4Call*__Deformedx5Call + msq*__Deformedx2Call + msq*__Deformedx2Call*SecDecInternalSqr(__Deformedx5Call)+msq*__Deformedx2Call*SecDecInternalSqr(__Deformedx4Call)+msq*__Deformedx2Call*SecDecInternalSqr(__Deformedx3Call)*SecDecInternalSqr(__Deformedx5Call)+msq*SecDecInternalSqr(__Deformedx2Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx2Call)*SecDecInternalSqr(__Deformedx5Call)+msq*SecDecInternalSqr(__Deformedx2Call)*__Deformedx4Call*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx2Call)*__Deformedx3Call*SecDecInternalSqr(__Deformedx5Call)+msq*__Deformedx1Call + msq*__Deformedx1Call*SecDecInternalSqr(__Deformedx4Call)+msq*__Deformedx1Call*SecDecInternalSqr(__Deformedx2Call)*SecDecInternalSqr(__Deformedx5Call)+msq*SecDecInternalSqr(__Deformedx1Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx1Call)*__Deformedx4Call*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx1Call)*__Deformedx2Call*SecDecInternalSqr(__Deformedx5Call)+msq*__Deformedx0Call*__Deformedx5Call + msq*__Deformedx0Call*SecDecInternalSqr(__Deformedx3Call)*__Deformedx5Call + msq*__Deformedx0Call*SecDecInternalSqr(__Deformedx2Call)*__Deformedx5Call + msq*__Deformedx0Call*SecDecInternalSqr(__Deformedx1Call)*__Deformedx5Call + msq*SecDecInternalSqr(__Deformedx0Call)+msq*SecDecInternalSqr(__Deformedx0Call)*__Deformedx3Call + msq*SecDecInternalSqr(__Deformedx0Call)*__Deformedx2Call + msq*SecDecInternalSqr(__Deformedx0Call)*__Deformedx1Call);
 }
+#endif
 }
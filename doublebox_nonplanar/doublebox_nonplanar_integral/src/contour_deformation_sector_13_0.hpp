@@ -5,5 +5,10 @@
 namespace doublebox_nonplanar_integral
 {
 secdecutil::SectorContainerWithDeformation<real_t, complex_t>::DeformedIntegrandFunction sector_13_order_0_contour_deformation_polynomial;
+#ifndef SECDEC_WITH_CUDA
+const unsigned sector_13_order_0_contour_deformation_polynomial_prefix_size = 18;
+contour_deformation_prefix_function_t sector_13_order_0_contour_deformation_polynomial_prefix;
+prefixed_contour_deformation_polynomial_t sector_13_order_0_contour_deformation_polynomial_from_prefix;
+#endif
 };
 #endif
@@ -0,0 +1,781 @@
+#include <secdecutil/deep_apply.hpp>
+#include <secdecutil/sector_container.hpp>
+#include <secdecutil/series.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "doublebox_nonplanar_integral.hpp"
+
+namespace doublebox_nonplanar_integral
+{
+    void for_each_in_parallel(unsigned long long count, const std::function<void(unsigned long long)>& body, unsigned number_of_threads)
+    {
+        if (number_of_threads == 0)
+            number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+        number_of_threads = static_cast<unsigned>(std::min<unsigned long long>(number_of_threads, count));
+
+        std::atomic<unsigned long long> next(0);
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        auto work = [&] ()
+        {
+            for (unsigned long long i = next++; i < count; i = next++)
+            {
+                try
+                {
+                    body(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (unsigned t = 1; t < number_of_threads; ++t)
+            threads.emplace_back(work);
+        work();
+        for (std::thread& thread : threads)
+            thread.join();
+        if (error)
+            std::rethrow_exception(error);
+    };
+
+    #if doublebox_nonplanar_integral_contour_deformation && !defined(SECDEC_WITH_CUDA)
+
+        void check_parameter_sizes(const std::vector<real_t>& real_parameters, const std::vector<complex_t>& complex_parameters);
+
+        namespace
+        {
+            thread_local const std::vector<real_t>* presampled = nullptr;
+
+            // identifies the generated code; set by the Makefile, nothing is
+            // cached without it
+            #ifdef SECDEC_PACKAGE_HASH
+                const std::string package_hash = SECDEC_PACKAGE_HASH;
+            #else
+                const std::string package_hash;
+            #endif
+
+            // The cache is a file of fixed-size records after a header. It
+            // is appended to under an exclusive lock and searched backwards
+            // in a read-only mapping, so that the latest record of a key
+            // wins. Failing to read or write it only costs presampling.
+            struct cache_header_t
+            {
+                char magic[8];
+                std::uint32_t record_size;
+                std::uint32_t reserved;
+            };
+
+            struct cache_record_t
+            {
+                std::uint64_t key[2];
+                std::uint32_t number_of_deformation_parameters;
+                std::uint32_t number_of_presamples;
+                real_t deformation_parameters[maximal_number_of_integration_variables];
+            };
+
+            const cache_header_t cache_header = {{'S','D','L','A','M','B','D','A'}, sizeof(cache_record_t), 0};
+
+            std::string cache_filename()
+            {
+                const char * const directory = std::getenv("SECDEC_DEFORMATION_PARAMETERS_CACHE");
+                if (package_hash.empty() || !directory || !*directory)
+                    return "";
+                return std::string(directory) + "/" + package_name + ".deformation_parameters";
+            };
+
+            // two 64 bit FNV-1a hashes with different offsets
+            struct cache_key_t
+            {
+                std::uint64_t hash[2] = {14695981039346656037ull, 1469598103934665603ull};
+
+                cache_key_t& add(const void * data, size_t size)
+                {
+                    const unsigned char * const bytes = static_cast<const unsigned char*>(data);
+                    for (std::uint64_t& h : hash)
+                        for (size_t i = 0; i < size; ++i)
+                            h = (h ^ bytes[i])*1099511628211ull;
+                    return *this;
+                };
+
+                template<typename T>
+                cache_key_t& add(const T& value)
+                {
+                    return add(&value, sizeof(T));
+                };
+            };
+
+            void load_cached
+            (
+                const std::string& filename,
+                const std::vector<cache_key_t>& keys,
+                std::vector<optimized_deformation_parameters_t>& optimized,
+                std::vector<bool>& found
+            )
+            {
+                const int fd = open(filename.c_str(), O_RDONLY);
+                if (fd < 0)
+                    return;
+                struct stat status;
+                if (flock(fd, LOCK_SH) == 0 && fstat(fd, &status) == 0 && static_cast<size_t>(status.st_size) >= sizeof(cache_header_t))
+                {
+                    const size_t size = status.st_size;
+                    void * const mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+                    if (mapping != MAP_FAILED)
+                    {
+                        const char * const begin = static_cast<const char*>(mapping);
+                        if (std::memcmp(begin, &cache_header, sizeof(cache_header_t)) == 0)
+                        {
+                            const size_t number_of_records = (size - sizeof(cache_header_t))/sizeof(cache_record_t);
+                            for (size_t k = 0; k < keys.size(); ++k)
+                                for (size_t r = number_of_records; r > 0; --r)
+                                {
+                                    cache_record_t record;
+                                    std::memcpy(&record, begin + sizeof(cache_header_t) + (r - 1)*sizeof(cache_record_t), sizeof(cache_record_t));
+                                    if (record.key[0] == keys[k].hash[0] && record.key[1] == keys[k].hash[1] &&
+                                        record.number_of_deformation_parameters <= maximal_number_of_integration_variables)
+                                    {
+                                        optimized[k].deformation_parameters.assign(record.deformation_parameters, record.deformation_parameters + record.number_of_deformation_parameters);
+                                        optimized[k].number_of_presamples = record.number_of_presamples;
+                                        found[k] = true;
+                                        break;
+                                    }
+                                }
+                        }
+                        munmap(mapping, size);
+                    }
+                }
+                close(fd);
+            };
+
+            void store_cached
+            (
+                const std::string& filename,
+                const std::vector<cache_key_t>& keys,
+                const std::vector<optimized_deformation_parameters_t>& optimized,
+                const std::vector<bool>& skip
+            )
+            {
+                std::vector<cache_record_t> records;
+                for (size_t k = 0; k < keys.size(); ++k)
+                    if (!skip[k])
+                    {
+                        cache_record_t record = {};
+                        record.key[0] = keys[k].hash[0];
+                        record.key[1] = keys[k].hash[1];
+                        record.number_of_deformation_parameters = optimized[k].deformation_parameters.size();
+                        record.number_of_presamples = optimized[k].number_of_presamples;
+                        std::copy(optimized[k].deformation_parameters.begin(), optimized[k].deformation_parameters.end(), record.deformation_parameters);
+                        records.push_back(record);
+                    }
+                if (records.empty())
+                    return;
+                const int fd = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+                if (fd < 0)
+                    return;
+                struct stat status;
+                if (flock(fd, LOCK_EX) == 0 && fstat(fd, &status) == 0)
+                {
+                    size_t size = status.st_size;
+                    cache_header_t header;
+                    bool valid = size == 0 && write(fd, &cache_header, sizeof(cache_header_t)) == sizeof(cache_header_t);
+                    if (size > 0)
+                        valid = pread(fd, &header, sizeof(cache_header_t), 0) == sizeof(cache_header_t) &&
+                                std::memcmp(&header, &cache_header, sizeof(cache_header_t)) == 0;
+                    size = std::max(size, sizeof(cache_header_t));
+                    // drop what an interrupted append left behind
+                    size -= (size - sizeof(cache_header_t)) % sizeof(cache_record_t);
+                    const size_t bytes = records.size()*sizeof(cache_record_t);
+                    if (valid && ftruncate(fd, size) == 0 && pwrite(fd, records.data(), bytes, size) != static_cast<ssize_t>(bytes))
+                        (void)ftruncate(fd, size);
+                }
+                close(fd);
+            };
+        };
+
+        void presampled_deformation_parameters
+        (
+            real_t * output_deformation_parameters,
+            real_t const * /* integration_variables */,
+            real_t const * /* real_parameters */,
+            complex_t const * /* complex_parameters */,
+            secdecutil::ResultInfo * /* result_info */
+        )
+        {
+            if (!presampled)
+                throw std::logic_error("Called \"presampled_deformation_parameters\" without \"use_presampled_deformation_parameters\".");
+            std::copy(presampled->begin(), presampled->end(), output_deformation_parameters);
+        };
+
+        void use_presampled_deformation_parameters(const std::vector<real_t>& deformation_parameters)
+        {
+            presampled = &deformation_parameters;
+        };
+
+        // whether the integrand passes its sign checks at one point, as in
+        // the integration: the imaginary part of its deformed F polynomial
+        // is not positive and the real part of the positive polynomial is
+        // not negative; both come out of a single evaluation of the
+        // integrand
+        bool passes_sign_checks
+        (
+            checked_integrand_t * integrand,
+            const real_t * integration_variables,
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const std::vector<real_t>& deformation_parameters
+        )
+        {
+            secdecutil::ResultInfo result_info;
+            real_t contour_deformation_check, positive_polynomial_check;
+            integrand(integration_variables, real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info, &contour_deformation_check, &positive_polynomial_check);
+            return contour_deformation_check <= 0 && positive_polynomial_check >= 0;
+        };
+
+        // how often presampling shrinks only some deformation parameters
+        // at the same failing point before it shrinks all of them
+        const unsigned maximal_retries = 8;
+
+        optimized_deformation_parameters_t optimize_deformation_parameters
+        (
+            const contour_deformation_prefix_t& sector,
+            checked_integrand_t * integrand,
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            unsigned number_of_presamples,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor,
+            unsigned number_of_initial_presamples,
+            real_t presampling_tolerance
+        )
+        {
+            const unsigned number_of_integration_variables = sector.number_of_integration_variables;
+            std::vector<real_t> deformation_parameters(number_of_integration_variables, deformation_parameters_maximum);
+            if (number_of_presamples == 0)
+                return {deformation_parameters, 0};
+
+            std::mt19937_64 random_number_generator(number_of_presamples);
+            std::uniform_real_distribution<real_t> uniform(0, 1);
+            std::vector<real_t> integration_variables;
+            std::vector<real_t> maximal_deformation_parameters(number_of_integration_variables);
+            std::vector<real_t> prefixes;
+            secdecutil::ResultInfo result_info;
+
+            // the largest deformation parameters allowed at every point, in
+            // stages of growing size until they settle; the part of the
+            // contour deformation polynomial that does not depend on them is
+            // evaluated once per point here
+            unsigned used = 0;
+            unsigned long long stage = std::max(1u, std::min(number_of_initial_presamples, number_of_presamples));
+            while (true)
+            {
+                const std::vector<real_t> previous = deformation_parameters;
+                prefixes.resize(stage*sector.prefix_size);
+                integration_variables.resize(stage*number_of_integration_variables);
+                for (unsigned i = used; i < stage; ++i)
+                {
+                    real_t * const x = &integration_variables[static_cast<size_t>(i)*number_of_integration_variables];
+                    for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                        x[j] = uniform(random_number_generator);
+                    sector.maximal_allowed_deformation_parameters(maximal_deformation_parameters.data(), x, real_parameters.data(), complex_parameters.data(), &result_info);
+                    for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                        deformation_parameters[j] = std::max(deformation_parameters_minimum, std::min(deformation_parameters[j], maximal_deformation_parameters[j]));
+                    sector.prefix(x, real_parameters.data(), complex_parameters.data(), &prefixes[static_cast<size_t>(i)*sector.prefix_size]);
+                }
+                bool settled = used > 0;
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    settled = settled && previous[j] - deformation_parameters[j] <= presampling_tolerance*previous[j];
+                used = static_cast<unsigned>(stage);
+                if (settled || used == number_of_presamples)
+                    break;
+                stage = std::min<unsigned long long>(4*stage, number_of_presamples);
+            }
+
+            // shrink the deformation parameters until the imaginary part of
+            // the deformed F polynomial is not positive at any point, and
+            // then until the integrand passes its own sign checks there,
+            // those of the integration; every attempt starts at the point
+            // where the previous one failed
+            std::vector<real_t> trial(number_of_integration_variables);
+            std::vector<bool> shrink(number_of_integration_variables);
+            unsigned failed = 0;
+            // attempts in a row that failed at the same point
+            unsigned retries = 0;
+            while (true)
+            {
+                const unsigned previously_failed = failed;
+                bool passed = true;
+                for (unsigned k = 0; k < used; ++k)
+                {
+                    const unsigned i = (failed + k) % used;
+                    if (std::imag(sector.polynomial(&prefixes[static_cast<size_t>(i)*sector.prefix_size], real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info)) > 0)
+                    {
+                        failed = i;
+                        passed = false;
+                        break;
+                    }
+                }
+                for (unsigned k = 0; passed && k < used; ++k)
+                {
+                    const unsigned i = (failed + k) % used;
+                    if (!passes_sign_checks(integrand, &integration_variables[static_cast<size_t>(i)*number_of_integration_variables], real_parameters, complex_parameters, deformation_parameters))
+                    {
+                        failed = i;
+                        passed = false;
+                    }
+                }
+                if (passed)
+                    return {deformation_parameters, used};
+                if (std::all_of(deformation_parameters.begin(), deformation_parameters.end(), [&](real_t lambda) { return lambda <= deformation_parameters_minimum; }))
+                    throw std::domain_error("Sign check of the contour deformation failed with the minimal deformation parameters (" + std::to_string(deformation_parameters_minimum) + ").");
+
+                // only shrink the deformation parameters that lower the
+                // imaginary part at the failing point on their own, or all of
+                // them if none does or if the same point has already failed
+                // "maximal_retries" times in a row with this choice
+                retries = failed == previously_failed ? retries + 1 : 0;
+                const real_t * const prefix = &prefixes[static_cast<size_t>(failed)*sector.prefix_size];
+                const real_t failing = std::imag(sector.polynomial(prefix, real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info));
+                bool any = false;
+                trial = deformation_parameters;
+                for (unsigned j = 0; j < number_of_integration_variables && retries < maximal_retries; ++j)
+                {
+                    trial[j] = std::max(deformation_parameters_minimum, deformation_parameters[j]*deformation_parameters_decrease_factor);
+                    shrink[j] = trial[j] < deformation_parameters[j] &&
+                        std::imag(sector.polynomial(prefix, real_parameters.data(), complex_parameters.data(), trial.data(), &result_info)) < failing;
+                    any = any || shrink[j];
+                    trial[j] = deformation_parameters[j];
+                }
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    if (shrink[j] || !any)
+                        deformation_parameters[j] = std::max(deformation_parameters_minimum, deformation_parameters[j]*deformation_parameters_decrease_factor);
+            }
+        };
+
+        // the sample variance of "integrand" at "integration_variables"
+        // (consecutive points), infinite if a sign check fails at any of them
+        real_t sign_checked_variance
+        (
+            checked_integrand_t * integrand,
+            const std::vector<real_t>& integration_variables,
+            unsigned number_of_integration_variables,
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const std::vector<real_t>& deformation_parameters
+        )
+        {
+            const size_t number_of_samples = integration_variables.size()/number_of_integration_variables;
+            secdecutil::ResultInfo result_info;
+            integrand_return_t sum = 0;
+            real_t sum_of_squares = 0;
+            for (size_t i = 0; i < number_of_samples; ++i)
+            {
+                real_t contour_deformation_check, positive_polynomial_check;
+                const integrand_return_t value = integrand(&integration_variables[i*number_of_integration_variables], real_parameters.data(), complex_parameters.data(), deformation_parameters.data(), &result_info, &contour_deformation_check, &positive_polynomial_check);
+                if (!(contour_deformation_check <= 0 && positive_polynomial_check >= 0 && std::isfinite(std::abs(value))))
+                    return std::numeric_limits<real_t>::infinity();
+                sum += value;
+                sum_of_squares += std::norm(value);
+            }
+            return (sum_of_squares - std::norm(sum)/number_of_samples)/(number_of_samples - 1);
+        };
+
+        optimized_deformation_parameters_t refine_deformation_parameters
+        (
+            const contour_deformation_prefix_t& sector,
+            checked_integrand_t * integrand,
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            optimized_deformation_parameters_t optimized,
+            unsigned number_of_samples,
+            unsigned number_of_rounds,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor
+        )
+        {
+            const unsigned number_of_integration_variables = sector.number_of_integration_variables;
+            std::vector<real_t>& deformation_parameters = optimized.deformation_parameters;
+            if (number_of_samples < 2 || deformation_parameters.size() != number_of_integration_variables)
+                return optimized;
+
+            // the samples, and the largest deformation parameters allowed at
+            // all of them
+            std::mt19937_64 random_number_generator(number_of_samples);
+            std::uniform_real_distribution<real_t> uniform(0, 1);
+            std::vector<real_t> integration_variables(static_cast<size_t>(number_of_samples)*number_of_integration_variables);
+            std::vector<real_t> upper_bounds(number_of_integration_variables, deformation_parameters_maximum);
+            std::vector<real_t> maximal_deformation_parameters(number_of_integration_variables);
+            secdecutil::ResultInfo result_info;
+            for (unsigned i = 0; i < number_of_samples; ++i)
+            {
+                real_t * const x = &integration_variables[static_cast<size_t>(i)*number_of_integration_variables];
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    x[j] = uniform(random_number_generator);
+                sector.maximal_allowed_deformation_parameters(maximal_deformation_parameters.data(), x, real_parameters.data(), complex_parameters.data(), &result_info);
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    upper_bounds[j] = std::max(deformation_parameters_minimum, std::min(upper_bounds[j], maximal_deformation_parameters[j]));
+            }
+            for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                deformation_parameters[j] = std::max(deformation_parameters_minimum, std::min(deformation_parameters[j], upper_bounds[j]));
+
+            auto variance = [&] (const std::vector<real_t>& trial)
+            {
+                return sign_checked_variance(integrand, integration_variables, number_of_integration_variables, real_parameters, complex_parameters, trial);
+            };
+            real_t best = variance(deformation_parameters);
+            while (!std::isfinite(best))
+            {
+                if (std::all_of(deformation_parameters.begin(), deformation_parameters.end(), [&](real_t lambda) { return lambda <= deformation_parameters_minimum; }))
+                    throw std::domain_error("Sign check of the contour deformation failed with the minimal deformation parameters (" + std::to_string(deformation_parameters_minimum) + ").");
+                for (real_t& lambda : deformation_parameters)
+                    lambda = std::max(deformation_parameters_minimum, lambda*deformation_parameters_decrease_factor);
+                best = variance(deformation_parameters);
+            }
+
+            // one variable at a time, keep every step by the decrease factor
+            // (up to the bound or down to the minimum) that lowers the
+            // variance
+            std::vector<real_t> trial = deformation_parameters;
+            for (unsigned round = 0; round < number_of_rounds; ++round)
+            {
+                bool improved = false;
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    for (const real_t step : {deformation_parameters_decrease_factor, 1/deformation_parameters_decrease_factor})
+                    {
+                        trial[j] = std::max(deformation_parameters_minimum, std::min(upper_bounds[j], deformation_parameters[j]*step));
+                        if (trial[j] == deformation_parameters[j])
+                            continue;
+                        const real_t candidate = variance(trial);
+                        if (candidate < best)
+                        {
+                            best = candidate;
+                            deformation_parameters[j] = trial[j];
+                            improved = true;
+                            break;
+                        }
+                        trial[j] = deformation_parameters[j];
+                    }
+                if (!improved)
+                    break;
+            }
+            return optimized;
+        };
+
+        // lowers "deformation_parameters" to the largest ones allowed at
+        // "number_of_validation_presamples" points and reports whether the
+        // integrand passes its sign checks at all of them
+        bool validate_deformation_parameters
+        (
+            const contour_deformation_prefix_t& sector,
+            checked_integrand_t * integrand,
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            std::vector<real_t>& deformation_parameters,
+            real_t deformation_parameters_minimum,
+            unsigned number_of_validation_presamples
+        )
+        {
+            const unsigned number_of_integration_variables = sector.number_of_integration_variables;
+            std::mt19937_64 random_number_generator(number_of_validation_presamples);
+            std::uniform_real_distribution<real_t> uniform(0, 1);
+            std::vector<real_t> integration_variables(static_cast<size_t>(number_of_validation_presamples)*number_of_integration_variables);
+            std::vector<real_t> maximal_deformation_parameters(number_of_integration_variables);
+            secdecutil::ResultInfo result_info;
+            for (unsigned i = 0; i < number_of_validation_presamples; ++i)
+            {
+                real_t * const x = &integration_variables[static_cast<size_t>(i)*number_of_integration_variables];
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    x[j] = uniform(random_number_generator);
+                sector.maximal_allowed_deformation_parameters(maximal_deformation_parameters.data(), x, real_parameters.data(), complex_parameters.data(), &result_info);
+                for (unsigned j = 0; j < number_of_integration_variables; ++j)
+                    deformation_parameters[j] = std::max(deformation_parameters_minimum, std::min(deformation_parameters[j], maximal_deformation_parameters[j]));
+            }
+            for (unsigned i = 0; i < number_of_validation_presamples; ++i)
+                if (!passes_sign_checks(integrand, &integration_variables[static_cast<size_t>(i)*number_of_integration_variables], real_parameters, complex_parameters, deformation_parameters))
+                    return false;
+            return true;
+        };
+
+        // with "previous", the deformation parameters of every sector and
+        // order not found in the cache are first tried from there
+        static std::vector<nested_series_t<optimized_deformation_parameters_t>> optimize_deformation_parameters
+        (
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const std::vector<nested_series_t<optimized_deformation_parameters_t>> * previous,
+            unsigned number_of_presamples,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor,
+            unsigned number_of_initial_presamples,
+            real_t presampling_tolerance,
+            unsigned number_of_validation_presamples
+        )
+        {
+            check_parameter_sizes(real_parameters, complex_parameters);
+
+            // deep_apply visits the sectors and orders in the same order
+            // every time
+            std::vector<const contour_deformation_prefix_t*> sectors;
+            secdecutil::deep_apply
+            (
+                get_contour_deformation_prefixes(),
+                [&sectors] (const contour_deformation_prefix_t& sector) { sectors.push_back(&sector); return 0; }
+            );
+            std::vector<checked_integrand_t*> integrands;
+            secdecutil::deep_apply
+            (
+                get_checked_integrands(),
+                [&integrands] (checked_integrand_t * integrand) { integrands.push_back(integrand); return 0; }
+            );
+            std::vector<const std::vector<real_t>*> guesses;
+            if (previous)
+            {
+                secdecutil::deep_apply
+                (
+                    *previous,
+                    [&guesses] (const optimized_deformation_parameters_t& sector) { guesses.push_back(&sector.deformation_parameters); return 0; }
+                );
+                if (guesses.size() != sectors.size())
+                    throw std::logic_error(
+                                                "Called \"doublebox_nonplanar_integral::optimize_deformation_parameters\" with deformation parameters of " +
+                                                std::to_string(guesses.size()) + " sectors and orders (" +
+                                                std::to_string(sectors.size()) + " expected)."
+                                          );
+            }
+            std::vector<optimized_deformation_parameters_t> optimized(sectors.size());
+            std::vector<bool> found(sectors.size(), false);
+
+            const std::string filename = cache_filename();
+            std::vector<cache_key_t> keys(sectors.size());
+            if (!filename.empty())
+            {
+                for (size_t i = 0; i < sectors.size(); ++i)
+                {
+                    keys[i].add(package_name.data(), package_name.size()).add('\0')
+                           .add(package_hash.data(), package_hash.size()).add('\0')
+                           .add(static_cast<std::uint64_t>(i))
+                           .add(real_parameters.data(), real_parameters.size()*sizeof(real_t))
+                           .add(complex_parameters.data(), complex_parameters.size()*sizeof(complex_t))
+                           .add(number_of_presamples)
+                           .add(deformation_parameters_maximum)
+                           .add(deformation_parameters_minimum)
+                           .add(deformation_parameters_decrease_factor)
+                           .add(number_of_initial_presamples)
+                           .add(presampling_tolerance);
+                }
+                load_cached(filename, keys, optimized, found);
+            }
+
+            std::vector<size_t> missing;
+            for (size_t i = 0; i < sectors.size(); ++i)
+                if (!found[i])
+                    missing.push_back(i);
+            // set by the workers, one element each (not std::vector<bool>,
+            // whose elements share words)
+            std::vector<char> guessed(sectors.size(), false);
+            for_each_in_parallel
+            (
+                missing.size(),
+                [&] (unsigned long long k)
+                {
+                    const size_t i = missing[k];
+                    if (previous && guesses[i]->size() == sectors[i]->number_of_integration_variables)
+                    {
+                        std::vector<real_t> guess = *guesses[i];
+                        for (real_t& lambda : guess)
+                            lambda = std::max(deformation_parameters_minimum, std::min(lambda, deformation_parameters_maximum));
+                        if (validate_deformation_parameters(*sectors[i], integrands[i], real_parameters, complex_parameters, guess, deformation_parameters_minimum, number_of_validation_presamples))
+                        {
+                            optimized[i] = {guess, number_of_validation_presamples};
+                            guessed[i] = true;
+                            return;
+                        }
+                    }
+                    optimized[i] = optimize_deformation_parameters
+                    (
+                        *sectors[i],
+                        integrands[i],
+                        real_parameters,
+                        complex_parameters,
+                        number_of_presamples,
+                        deformation_parameters_maximum,
+                        deformation_parameters_minimum,
+                        deformation_parameters_decrease_factor,
+                        number_of_initial_presamples,
+                        presampling_tolerance
+                    );
+                }
+            );
+            // validated guesses depend on the previous point and were
+            // only checked at number_of_validation_presamples points, so
+            // unlike presampled ones they are not cached
+            if (!filename.empty())
+            {
+                std::vector<bool> skip(sectors.size());
+                for (size_t i = 0; i < sectors.size(); ++i)
+                    skip[i] = found[i] || guessed[i];
+                store_cached(filename, keys, optimized, skip);
+            }
+
+            size_t next = 0;
+            return secdecutil::deep_apply
+            (
+                get_contour_deformation_prefixes(),
+                [&optimized, &next] (const contour_deformation_prefix_t&) { return optimized[next++]; }
+            );
+        };
+
+        std::vector<nested_series_t<optimized_deformation_parameters_t>> optimize_deformation_parameters
+        (
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            unsigned number_of_presamples,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor,
+            unsigned number_of_initial_presamples,
+            real_t presampling_tolerance
+        )
+        {
+            return optimize_deformation_parameters
+            (
+                real_parameters,
+                complex_parameters,
+                nullptr,
+                number_of_presamples,
+                deformation_parameters_maximum,
+                deformation_parameters_minimum,
+                deformation_parameters_decrease_factor,
+                number_of_initial_presamples,
+                presampling_tolerance,
+                0
+            );
+        };
+
+        std::vector<nested_series_t<optimized_deformation_parameters_t>> optimize_deformation_parameters
+        (
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const std::vector<nested_series_t<optimized_deformation_parameters_t>>& previous,
+            unsigned number_of_validation_presamples,
+            unsigned number_of_presamples,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor,
+            unsigned number_of_initial_presamples,
+            real_t presampling_tolerance
+        )
+        {
+            return optimize_deformation_parameters
+            (
+                real_parameters,
+                complex_parameters,
+                &previous,
+                number_of_presamples,
+                deformation_parameters_maximum,
+                deformation_parameters_minimum,
+                deformation_parameters_decrease_factor,
+                number_of_initial_presamples,
+                presampling_tolerance,
+                number_of_validation_presamples
+            );
+        };
+
+        std::vector<nested_series_t<optimized_deformation_parameters_t>> refine_deformation_parameters
+        (
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const std::vector<nested_series_t<optimized_deformation_parameters_t>>& optimized,
+            unsigned number_of_samples,
+            unsigned number_of_rounds,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor
+        )
+        {
+            check_parameter_sizes(real_parameters, complex_parameters);
+
+            // deep_apply visits the sectors and orders in the same order
+            // every time
+            std::vector<const contour_deformation_prefix_t*> sectors;
+            secdecutil::deep_apply
+            (
+                get_contour_deformation_prefixes(),
+                [&sectors] (const contour_deformation_prefix_t& sector) { sectors.push_back(&sector); return 0; }
+            );
+            std::vector<checked_integrand_t*> integrands;
+            secdecutil::deep_apply
+            (
+                get_checked_integrands(),
+                [&integrands] (checked_integrand_t * integrand) { integrands.push_back(integrand); return 0; }
+            );
+            std::vector<const optimized_deformation_parameters_t*> initial;
+            secdecutil::deep_apply
+            (
+                optimized,
+                [&initial] (const optimized_deformation_parameters_t& sector) { initial.push_back(&sector); return 0; }
+            );
+            if (initial.size() != sectors.size())
+                throw std::logic_error(
+                                            "Called \"doublebox_nonplanar_integral::refine_deformation_parameters\" with deformation parameters of " +
+                                            std::to_string(initial.size()) + " sectors and orders (" +
+                                            std::to_string(sectors.size()) + " expected)."
+                                      );
+
+            std::vector<optimized_deformation_parameters_t> refined(sectors.size());
+            for_each_in_parallel
+            (
+                sectors.size(),
+                [&] (unsigned long long i)
+                {
+                    refined[i] = refine_deformation_parameters
+                    (
+                        *sectors[i],
+                        integrands[i],
+                        real_parameters,
+                        complex_parameters,
+                        *initial[i],
+                        number_of_samples,
+                        number_of_rounds,
+                        deformation_parameters_maximum,
+                        deformation_parameters_minimum,
+                        deformation_parameters_decrease_factor
+                    );
+                }
+            );
+            size_t next = 0;
+            return secdecutil::deep_apply
+            (
+                optimized,
+                [&refined, &next] (const optimized_deformation_parameters_t&) { return refined[next++]; }
+            );
+        };
+
+    #endif
+};
@@ -1,6 +1,8 @@
 #include <secdecutil/deep_apply.hpp>
 #include <secdecutil/sector_container.hpp>
 #include <secdecutil/series.hpp>
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -26,6 +28,82 @@ nested_series_t<sector_container_t> get_integrand_of_sector_15();
 nested_series_t<sector_container_t> get_integrand_of_sector_16();
 nested_series_t<sector_container_t> get_integrand_of_sector_17();
 nested_series_t<sector_container_t> get_integrand_of_sector_18();
+#ifndef SECDEC_WITH_CUDA
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_1();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_2();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_3();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_4();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_5();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_6();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_7();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_8();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_9();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_10();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_11();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_12();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_13();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_14();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_15();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_16();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_17();
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_18();
+#if doublebox_nonplanar_integral_contour_deformation
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_1();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_2();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_3();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_4();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_5();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_6();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_7();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_8();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_9();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_10();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_11();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_12();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_13();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_14();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_15();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_16();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_17();
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_18();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_1();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_2();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_3();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_4();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_5();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_6();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_7();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_8();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_9();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_10();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_11();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_12();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_13();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_14();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_15();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_16();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_17();
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_18();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_1();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_2();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_3();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_4();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_5();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_6();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_7();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_8();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_9();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_10();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_11();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_12();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_13();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_14();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_15();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_16();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_17();
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_18();
+#endif
+#endif
 
 
     static std::unique_ptr<std::vector<nested_series_t<sector_container_t>>> sectors;
@@ -36,6 +114,41 @@ nested_series_t<sector_container_t> get_integrand_of_sector_18();
         return *sectors;
     };
 
+    #ifndef SECDEC_WITH_CUDA
+        static std::unique_ptr<std::vector<nested_series_t<batch_integrand_t*>>> batch_integrands;
+        const std::vector<nested_series_t<batch_integrand_t*>>& get_batch_integrands()
+        {
+            if (!batch_integrands)
+                batch_integrands.reset( new std::vector<nested_series_t<batch_integrand_t*>>{get_batch_integrand_of_sector_1(),get_batch_integrand_of_sector_2(),get_batch_integrand_of_sector_3(),get_batch_integrand_of_sector_4(),get_batch_integrand_of_sector_5(),get_batch_integrand_of_sector_6(),get_batch_integrand_of_sector_7(),get_batch_integrand_of_sector_8(),get_batch_integrand_of_sector_9(),get_batch_integrand_of_sector_10(),get_batch_integrand_of_sector_11(),get_batch_integrand_of_sector_12(),get_batch_integrand_of_sector_13(),get_batch_integrand_of_sector_14(),get_batch_integrand_of_sector_15(),get_batch_integrand_of_sector_16(),get_batch_integrand_of_sector_17(),get_batch_integrand_of_sector_18()} );
+            return *batch_integrands;
+        };
+        #if doublebox_nonplanar_integral_contour_deformation
+            static std::unique_ptr<std::vector<nested_series_t<checked_integrand_t*>>> checked_integrands;
+            const std::vector<nested_series_t<checked_integrand_t*>>& get_checked_integrands()
+            {
+                if (!checked_integrands)
+                    checked_integrands.reset( new std::vector<nested_series_t<checked_integrand_t*>>{get_checked_integrand_of_sector_1(),get_checked_integrand_of_sector_2(),get_checked_integrand_of_sector_3(),get_checked_integrand_of_sector_4(),get_checked_integrand_of_sector_5(),get_checked_integrand_of_sector_6(),get_checked_integrand_of_sector_7(),get_checked_integrand_of_sector_8(),get_checked_integrand_of_sector_9(),get_checked_integrand_of_sector_10(),get_checked_integrand_of_sector_11(),get_checked_integrand_of_sector_12(),get_checked_integrand_of_sector_13(),get_checked_integrand_of_sector_14(),get_checked_integrand_of_sector_15(),get_checked_integrand_of_sector_16(),get_checked_integrand_of_sector_17(),get_checked_integrand_of_sector_18()} );
+                return *checked_integrands;
+            };
+
+            static std::unique_ptr<std::vector<nested_series_t<contour_deformation_prefix_t>>> contour_deformation_prefixes;
+            const std::vector<nested_series_t<contour_deformation_prefix_t>>& get_contour_deformation_prefixes()
+            {
+                if (!contour_deformation_prefixes)
+                    contour_deformation_prefixes.reset( new std::vector<nested_series_t<contour_deformation_prefix_t>>{get_contour_deformation_prefix_of_sector_1(),get_contour_deformation_prefix_of_sector_2(),get_contour_deformation_prefix_of_sector_3(),get_contour_deformation_prefix_of_sector_4(),get_contour_deformation_prefix_of_sector_5(),get_contour_deformation_prefix_of_sector_6(),get_contour_deformation_prefix_of_sector_7(),get_contour_deformation_prefix_of_sector_8(),get_contour_deformation_prefix_of_sector_9(),get_contour_deformation_prefix_of_sector_10(),get_contour_deformation_prefix_of_sector_11(),get_contour_deformation_prefix_of_sector_12(),get_contour_deformation_prefix_of_sector_13(),get_contour_deformation_prefix_of_sector_14(),get_contour_deformation_prefix_of_sector_15(),get_contour_deformation_prefix_of_sector_16(),get_contour_deformation_prefix_of_sector_17(),get_contour_deformation_prefix_of_sector_18()} );
+                return *contour_deformation_prefixes;
+            };
+
+            static std::unique_ptr<std::vector<nested_series_t<sector_container_t>>> presampled_sectors;
+            const std::vector<nested_series_t<sector_container_t>>& get_presampled_sectors()
+            {
+                if (!presampled_sectors)
+                    presampled_sectors.reset( new std::vector<nested_series_t<sector_container_t>>{get_presampled_integrand_of_sector_1(),get_presampled_integrand_of_sector_2(),get_presampled_integrand_of_sector_3(),get_presampled_integrand_of_sector_4(),get_presampled_integrand_of_sector_5(),get_presampled_integrand_of_sector_6(),get_presampled_integrand_of_sector_7(),get_presampled_integrand_of_sector_8(),get_presampled_integrand_of_sector_9(),get_presampled_integrand_of_sector_10(),get_presampled_integrand_of_sector_11(),get_presampled_integrand_of_sector_12(),get_presampled_integrand_of_sector_13(),get_presampled_integrand_of_sector_14(),get_presampled_integrand_of_sector_15(),get_presampled_integrand_of_sector_16(),get_presampled_integrand_of_sector_17(),get_presampled_integrand_of_sector_18()} );
+                return *presampled_sectors;
+            };
+        #endif
+    #endif
+
     void check_parameter_sizes(const std::vector<real_t>& real_parameters, const std::vector<complex_t>& complex_parameters)
     {
         if ( real_parameters.size() != doublebox_nonplanar_integral::number_of_real_parameters )
@@ -56,24 +169,55 @@ nested_series_t<sector_container_t> get_integrand_of_sector_18();
 
     #define doublebox_nonplanar_integral_contour_deformation 1
 
-    std::vector<nested_series_t<secdecutil::IntegrandContainer<integrand_return_t, real_t const * const, real_t>>> make_integrands
-    (
-        const std::vector<real_t>& real_parameters,
-        const std::vector<complex_t>& complex_parameters
-        #if doublebox_nonplanar_integral_contour_deformation
-            ,unsigned number_of_presamples,
+    #if doublebox_nonplanar_integral_contour_deformation && !defined(SECDEC_WITH_CUDA)
+        typedef std::vector<nested_series_t<optimized_deformation_parameters_t>> previous_t;
+    #else
+        typedef void previous_t;
+    #endif
+
+    #if doublebox_nonplanar_integral_contour_deformation
+        // with "previous", as optimize_deformation_parameters(..., previous,
+        // ...)
+        static std::vector<nested_series_t<integrand_t>> make_integrands
+        (
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const previous_t * previous,
+            unsigned number_of_validation_presamples,
+            unsigned number_of_presamples,
             real_t deformation_parameters_maximum,
             real_t deformation_parameters_minimum,
             real_t deformation_parameters_decrease_factor
-        #endif
-    )
+        )
+    #else
+        static std::vector<nested_series_t<integrand_t>> make_integrands
+        (
+            const std::vector<real_t>& real_parameters,
+            const std::vector<complex_t>& complex_parameters,
+            const previous_t * previous
+        )
+    #endif
     {
         check_parameter_sizes(real_parameters, complex_parameters);
         #if doublebox_nonplanar_integral_contour_deformation
-            return secdecutil::deep_apply
-            (
-                get_sectors(),
-                secdecutil::SectorContainerWithDeformation_to_IntegrandContainer
+            #ifndef SECDEC_WITH_CUDA
+                // the package presamples, validates the guesses from
+                // "previous" or finds the deformation parameters in its
+                // cache; secdecutil then only repeats the sign check at a
+                // single point
+                const std::vector<nested_series_t<optimized_deformation_parameters_t>> optimized = previous ?
+                    optimize_deformation_parameters
+                    (
+                        real_parameters,
+                        complex_parameters,
+                        *previous,
+                        number_of_validation_presamples,
+                        number_of_presamples,
+                        deformation_parameters_maximum,
+                        deformation_parameters_minimum,
+                        deformation_parameters_decrease_factor
+                    ) :
+                    optimize_deformation_parameters
                     (
                         real_parameters,
                         complex_parameters,
@@ -81,13 +225,117 @@ nested_series_t<sector_container_t> get_integrand_of_sector_18();
                         deformation_parameters_maximum,
                         deformation_parameters_minimum,
                         deformation_parameters_decrease_factor
-                    )
+                    );
+                std::vector<const std::vector<real_t>*> deformation_parameters;
+                secdecutil::deep_apply
+                (
+                    optimized,
+                    [&deformation_parameters] (const optimized_deformation_parameters_t& sector) { deformation_parameters.push_back(&sector.deformation_parameters); return 0; }
+                );
+                const std::vector<nested_series_t<sector_container_t>>& all_sectors = get_presampled_sectors();
+                number_of_presamples = std::min(number_of_presamples, 1u);
+            #else
+                (void)previous; (void)number_of_validation_presamples;
+                const std::vector<nested_series_t<sector_container_t>>& all_sectors = get_sectors();
+            #endif
+            auto to_integrand = secdecutil::SectorContainerWithDeformation_to_IntegrandContainer
+                (
+                    real_parameters,
+                    complex_parameters,
+                    number_of_presamples,
+                    deformation_parameters_maximum,
+                    deformation_parameters_minimum,
+                    deformation_parameters_decrease_factor
+                );
+
+            // presample all sectors and orders at once; deep_apply visits
+            // them in the same order every time
+            std::vector<const sector_container_t*> sector_containers;
+            secdecutil::deep_apply
+            (
+                all_sectors,
+                [&sector_containers] (const sector_container_t& sector_container) { sector_containers.push_back(&sector_container); return 0; }
+            );
+            std::vector<std::unique_ptr<integrand_t>> integrands(sector_containers.size());
+            for_each_in_parallel
+            (
+                sector_containers.size(),
+                [&] (unsigned long long i)
+                {
+                    #ifndef SECDEC_WITH_CUDA
+                        use_presampled_deformation_parameters(*deformation_parameters[i]);
+                    #endif
+                    integrands[i].reset( new integrand_t(to_integrand(*sector_containers[i])) );
+                }
+            );
+            size_t next = 0;
+            return secdecutil::deep_apply
+            (
+                all_sectors,
+                [&integrands, &next] (const sector_container_t&) { return *integrands[next++]; }
             );
         #else
+            (void)previous;
             return secdecutil::deep_apply( get_sectors(), secdecutil::SectorContainerWithoutDeformation_to_IntegrandContainer<integrand_return_t>(real_parameters, complex_parameters) );
         #endif
     };
 
+    std::vector<nested_series_t<secdecutil::IntegrandContainer<integrand_return_t, real_t const * const, real_t>>> make_integrands
+    (
+        const std::vector<real_t>& real_parameters,
+        const std::vector<complex_t>& complex_parameters
+        #if doublebox_nonplanar_integral_contour_deformation
+            ,unsigned number_of_presamples,
+            real_t deformation_parameters_maximum,
+            real_t deformation_parameters_minimum,
+            real_t deformation_parameters_decrease_factor
+        #endif
+    )
+    {
+        return make_integrands
+        (
+            real_parameters,
+            complex_parameters,
+            nullptr
+            #if doublebox_nonplanar_integral_contour_deformation
+                ,0,
+                number_of_presamples,
+                deformation_parameters_maximum,
+                deformation_parameters_minimum,
+                deformation_parameters_decrease_factor
+            #endif
+        );
+    };
+
+    #ifndef SECDEC_WITH_CUDA
+        #if doublebox_nonplanar_integral_contour_deformation
+            std::vector<nested_series_t<integrand_t>> make_integrands
+            (
+                const std::vector<real_t>& real_parameters,
+                const std::vector<complex_t>& complex_parameters,
+                const std::vector<nested_series_t<optimized_deformation_parameters_t>>& previous,
+                unsigned number_of_validation_presamples,
+                unsigned number_of_presamples,
+                real_t deformation_parameters_maximum,
+                real_t deformation_parameters_minimum,
+                real_t deformation_parameters_decrease_factor
+            )
+            {
+                return make_integrands
+                (
+                    real_parameters,
+                    complex_parameters,
+                    &previous,
+                    number_of_validation_presamples,
+                    number_of_presamples,
+                    deformation_parameters_maximum,
+                    deformation_parameters_minimum,
+                    deformation_parameters_decrease_factor
+                );
+            };
+        #endif
+    #endif
+
     #ifdef SECDEC_WITH_CUDA
         #if doublebox_nonplanar_integral_contour_deformation
             std::vector<nested_series_t<
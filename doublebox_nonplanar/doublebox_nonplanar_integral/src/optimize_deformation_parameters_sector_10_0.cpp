@@ -54,6 +54,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_24 = tmp3_22 + tmp3_23;
     auto tmp3_25 = x5*x0*tmp3_24;
     auto tmp3_26 = tmp3_25 + tmp3_19;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_26))));
     auto tmp3_27 = x0 + 1;
     auto tmp3_28 = tmp3_27 + x3;
     auto tmp1_10 = tmp3_28*x4;
@@ -108,6 +109,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_58 = x5*tmp3_57;
     auto tmp3_59 = tmp1_26*tmp1_23;
     auto tmp3_60 = tmp3_53 + tmp3_59 + tmp3_58;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_60))));
     auto tmp3_61 = tmp3_21 + tmp1_26 + t;
     auto tmp3_62 = tmp3_61*x4;
     auto tmp3_63 = tmp3_61*tmp3_20;
@@ -140,6 +142,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_87 = tmp3_86 + tmp3_85;
     auto tmp3_88 = msq*tmp3_87;
     auto tmp3_89 = tmp3_88 + tmp3_70;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_89))));
     auto tmp3_90 = x3-1;
     auto tmp3_91 = tmp3_90*x3;
     auto tmp3_92 = tmp3_91*x4;
@@ -173,6 +176,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_119 = x5*tmp3_118;
     auto tmp3_120 = tmp3_114*tmp3_15;
     auto tmp3_121 = tmp3_112 + tmp3_119 + tmp3_116 + tmp3_120;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_121))));
     auto tmp3_122 = tmp1_25-t;
     auto tmp3_123 = tmp3_122*tmp3_43;
     auto tmp3_124 = tmp3_123 + tmp3_62-tmp3_61;
@@ -201,6 +205,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_147 = msq*tmp3_146;
     auto tmp3_148 = tmp1_26*tmp3_144;
     auto tmp3_149 = tmp3_147 + tmp3_148 + tmp3_129;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_149))));
     auto tmp3_150 = tmp1_26-2*tmp1_25;
     auto tmp3_151 = x2*tmp3_150;
     auto tmp3_152 = tmp3_151 + tmp3_56;
@@ -236,11 +241,6 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_182 = tmp1_28*x1;
     auto tmp3_183 = tmp3_181 + tmp3_157-tmp3_63-tmp3_182;
     auto tmp3_184 = x5*tmp3_183;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_26))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_60))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_89))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_121))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_149))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_184))));
 }
 }
@@ -56,6 +56,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_26 = tmp3_25 + tmp3_22;
     auto tmp3_27 = x5*tmp3_26;
     auto tmp3_28 = tmp3_27 + tmp3_19;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
     auto tmp3_29 = x0 + 1;
     auto tmp3_30 = tmp3_29*x1;
     auto tmp3_31 = tmp3_30-tmp3_29;
@@ -98,6 +99,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_60 = -tmp3_20 + tmp3_59;
     auto tmp3_61 = x1*tmp3_60*tmp3_42;
     auto tmp3_62 = tmp3_55 + tmp3_58 + tmp3_61;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_62))));
     auto tmp3_63 = tmp3_29 + x3;
     auto tmp3_64 = tmp3_63*x4;
     auto tmp3_65 = tmp3_64 + tmp3_30;
@@ -149,6 +151,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_95 = x5*tmp3_94;
     auto tmp3_96 = tmp1_31*tmp1_29;
     auto tmp3_97 = tmp3_90 + tmp3_96 + tmp3_95;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_97))));
     auto tmp3_98 = x2*x3;
     auto tmp3_99 = x4*x3;
     auto tmp3_100 = tmp3_98 + tmp3_99;
@@ -184,6 +187,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_128 = tmp3_56 + t;
     auto tmp3_129 = x3*tmp3_128*tmp3_111;
     auto tmp3_130 = tmp3_124 + tmp3_129 + tmp3_127;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_130))));
     auto tmp3_131 = t + tmp3_23 + tmp1_31;
     auto tmp3_132 = tmp3_131*x4;
     auto tmp3_133 = tmp3_91-t;
@@ -217,6 +221,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_161 = msq*tmp3_160;
     auto tmp3_162 = tmp1_31*tmp3_158;
     auto tmp3_163 = tmp3_161 + tmp3_162 + tmp3_140;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_163))));
     auto tmp3_164 = tmp3_144-x3 + tmp3_46-tmp1_1;
     auto tmp3_165 = x2*tmp3_164;
     auto tmp3_166 = 3*x0;
@@ -249,11 +254,6 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_193 = tmp1_32*x2;
     auto tmp3_194 = tmp3_187 + tmp3_192-tmp3_132-tmp3_193;
     auto tmp3_195 = x5*tmp3_194;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_62))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_97))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_130))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_163))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_195))));
 }
 }
@@ -85,6 +85,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_37 = tmp3_36*x1;
     auto tmp3_38 = tmp3_34 + tmp3_5-tmp1_5-tmp3_37;
     auto tmp3_39 = x0*tmp3_38;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_39))));
     auto tmp3_40 = tmp1_21 + tmp3_15;
     auto tmp3_41 = -x1*tmp1_23;
     auto tmp3_42 = tmp3_41-tmp3_14-3*tmp3_40;
@@ -118,6 +119,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_70 = tmp1_2*x5;
     auto tmp3_71 = tmp3_70*tmp3_62;
     auto tmp3_72 = tmp3_65 + tmp3_71 + tmp3_69;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_72))));
     auto tmp3_73 = x2-1;
     auto tmp3_74 = tmp3_73*x2;
     auto tmp3_75 = tmp3_74*x3;
@@ -154,6 +156,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_102 = tmp1_2-t;
     auto tmp3_103 = tmp3_102*tmp3_101;
     auto tmp3_104 = tmp3_96 + tmp3_103;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_104))));
     auto tmp3_105 = tmp3_47*x3;
     auto tmp3_106 = -tmp3_14*tmp3_105;
     auto tmp3_107 = tmp3_15-tmp3_14;
@@ -186,6 +189,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_133 = -tmp3_70 + tmp3_132;
     auto tmp3_134 = x3*tmp3_133;
     auto tmp3_135 = tmp3_121 + tmp3_134 + tmp3_130;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_135))));
     auto tmp3_136 = -x3*tmp1_3;
     auto tmp3_137 = -tmp1_6 + tmp1_12;
     auto tmp3_138 = tmp3_137*tmp1_10;
@@ -216,6 +220,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_163 = msq*tmp3_162;
     auto tmp3_164 = tmp3_70*tmp3_160;
     auto tmp3_165 = tmp3_163 + tmp3_164 + tmp3_144;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_165))));
     auto tmp3_166 = x5-1;
     auto tmp3_167 = tmp3_166*x5;
     auto tmp3_168 = -tmp3_167*tmp3_79;
@@ -245,11 +250,6 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_192 = tmp1_1-t;
     auto tmp3_193 = x0*tmp3_131*tmp3_192*tmp3_191;
     auto tmp3_194 = tmp3_188 + tmp3_193 + tmp3_190;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_39))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_72))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_104))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_135))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_165))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_194))));
 }
 }
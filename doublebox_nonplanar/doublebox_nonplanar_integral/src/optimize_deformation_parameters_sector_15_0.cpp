@@ -85,6 +85,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_36 = tmp3_35*x2;
     auto tmp3_37 = tmp3_33 + tmp3_5-tmp1_9-tmp3_36;
     auto tmp3_38 = x0*tmp3_37;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_38))));
     auto tmp3_39 = x1-1;
     auto tmp3_40 = tmp3_39*x1;
     auto tmp3_41 = tmp3_40*x4;
@@ -115,6 +116,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_64 = tmp3_61 + tmp3_63;
     auto tmp3_65 = x0*x1*tmp3_64;
     auto tmp3_66 = tmp3_65 + tmp3_59;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_66))));
     auto tmp3_67 = tmp1_21 + tmp3_15;
     auto tmp3_68 = -x2*tmp1_23;
     auto tmp3_69 = tmp3_68-tmp3_14-3*tmp3_67;
@@ -147,6 +149,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_96 = x0*tmp3_95;
     auto tmp3_97 = tmp1_4*tmp3_89;
     auto tmp3_98 = tmp3_92 + tmp3_97 + tmp3_96;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_98))));
     auto tmp3_99 = x3-1;
     auto tmp3_100 = tmp3_99*x3;
     auto tmp3_101 = tmp3_100*x4;
@@ -179,6 +182,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_128 = x0*tmp3_127;
     auto tmp3_129 = tmp3_123*tmp3_55;
     auto tmp3_130 = tmp3_121 + tmp3_128 + tmp3_125 + tmp3_129;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_130))));
     auto tmp3_131 = tmp1_7*x4;
     auto tmp3_132 = tmp1_2-t;
     auto tmp3_133 = tmp3_132*tmp1_10;
@@ -208,6 +212,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_157 = msq*tmp3_156;
     auto tmp3_158 = tmp1_4*tmp3_154;
     auto tmp3_159 = tmp3_157 + tmp3_158 + tmp3_139;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_159))));
     auto tmp3_160 = tmp3_34-tmp1_4;
     auto tmp3_161 = x2*tmp3_160;
     auto tmp3_162 = -tmp1_2 + tmp1_12;
@@ -236,11 +241,6 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_185 = tmp3_184 + tmp3_183;
     auto tmp3_186 = msq*tmp3_185;
     auto tmp3_187 = tmp3_186 + tmp3_167;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_38))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_66))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_98))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_130))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_159))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_187))));
 }
 }
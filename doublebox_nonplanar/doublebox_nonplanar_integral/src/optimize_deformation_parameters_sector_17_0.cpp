@@ -78,6 +78,7 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_30 = tmp1_24*x3;
     auto tmp3_31 = tmp3_30*tmp1_18;
     auto tmp3_32 = tmp3_25 + tmp3_31 + tmp3_29;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_32))));
     auto tmp3_33 = tmp3_7*x1;
     auto tmp3_34 = -tmp1_2*tmp3_33;
     auto tmp3_35 = tmp1_3-tmp1_2;
@@ -112,6 +113,7 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_61 = -tmp3_30 + tmp3_60;
     auto tmp3_62 = x1*tmp3_61;
     auto tmp3_63 = tmp3_47 + tmp3_62 + tmp3_58;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_63))));
     auto tmp3_64 = x2-1;
     auto tmp3_65 = tmp3_64*x2;
     auto tmp3_66 = tmp3_65*x1;
@@ -148,6 +150,7 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_93 = tmp1_24-t;
     auto tmp3_94 = tmp3_93*tmp3_92;
     auto tmp3_95 = tmp3_87 + tmp3_94;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_95))));
     auto tmp3_96 = x3-1;
     auto tmp3_97 = tmp3_96*x3;
     auto tmp3_98 = -tmp3_97*tmp3_70;
@@ -178,6 +181,7 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_122 = tmp1_21-t;
     auto tmp3_123 = x5*tmp3_59*tmp3_122*tmp3_121;
     auto tmp3_124 = tmp3_118 + tmp3_123 + tmp3_120;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_124))));
     auto tmp3_125 = tmp3_48*tmp3_26;
     auto tmp3_126 = -x1*tmp3_48;
     auto tmp3_127 = -tmp3_50 + tmp1_20;
@@ -210,6 +214,7 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_154 = msq*tmp3_153;
     auto tmp3_155 = tmp3_30*tmp3_151;
     auto tmp3_156 = tmp3_154 + tmp3_155 + tmp3_134;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_156))));
     auto tmp3_157 = tmp1_24-2*tmp3_50;
     auto tmp3_158 = x4*tmp3_157;
     auto tmp3_159 = tmp3_158 + tmp1_23;
@@ -245,11 +250,6 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_189 = tmp1_26*x0;
     auto tmp3_190 = tmp3_188 + tmp3_164-tmp3_125-tmp3_189;
     auto tmp3_191 = x5*tmp3_190;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_32))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_63))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_95))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_124))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_156))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_191))));
 }
 }
@@ -59,6 +59,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_26 = tmp3_22 + tmp3_25;
     auto tmp3_27 = x0*tmp3_26;
     auto tmp3_28 = tmp3_18 + tmp3_27;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
     auto tmp3_29 = -x3-tmp1_1;
     auto tmp3_30 = 1 + 3*x0;
     auto tmp3_31 = tmp3_30*tmp3_29;
@@ -122,6 +123,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_69 = tmp3_62*x4;
     auto tmp3_70 = tmp3_69*tmp3_59;
     auto tmp3_71 = tmp3_61 + tmp3_70 + tmp3_68;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_71))));
     auto tmp3_72 = t + tmp1_26 + tmp3_62;
     auto tmp3_73 = tmp3_72*x2;
     auto tmp1_33 = x2-1;
@@ -157,6 +159,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_102 = -tmp3_69 + tmp3_101;
     auto tmp3_103 = x2*tmp3_102;
     auto tmp3_104 = tmp3_99 + tmp3_103 + tmp3_79;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_104))));
     auto tmp3_105 = x3-1;
     auto tmp3_106 = tmp3_105*tmp3_19;
     auto tmp3_107 = SecDecInternalSqr(x3);
@@ -193,6 +196,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_136 = tmp3_19*tmp3_135;
     auto tmp3_137 = x5*x3*tmp3_132;
     auto tmp3_138 = tmp3_130 + tmp3_137 + tmp3_136;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_138))));
     auto tmp3_139 = x1*x4;
     auto tmp3_140 = tmp3_139 + tmp3_100;
     auto tmp3_141 = x4 + x3;
@@ -229,6 +233,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_172 = -tmp3_134 + tmp3_171;
     auto tmp3_173 = x4*tmp3_172;
     auto tmp3_174 = tmp3_165 + tmp3_170 + tmp3_173 + tmp3_167;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_174))));
     auto tmp3_175 = tmp1_13 + 2*tmp1_18;
     auto tmp3_176 = tmp3_175*x2;
     auto tmp3_177 = tmp3_176 + tmp3_48 + tmp3_117 + tmp3_159;
@@ -258,11 +263,6 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_201 = x5*tmp3_200;
     auto tmp3_202 = tmp3_194 + tmp3_201-tmp3_73-tmp1_29;
     auto tmp3_203 = x5*tmp3_202;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_71))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_104))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_138))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_174))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_203))));
 }
 }
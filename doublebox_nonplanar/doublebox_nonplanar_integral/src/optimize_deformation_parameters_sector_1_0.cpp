@@ -63,6 +63,7 @@ void sector_1_order_0_maximal_allowed_deformation_parameters
     auto tmp3_25 = tmp3_21 + tmp3_24;
     auto tmp3_26 = x0*tmp3_25;
     auto tmp3_27 = tmp3_17 + tmp3_26;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
     auto tmp3_28 = tmp1_11 + 3;
     auto tmp3_29 = tmp3_28*x2;
     auto tmp3_30 = tmp3_28*x5;
@@ -123,6 +124,7 @@ void sector_1_order_0_maximal_allowed_deformation_parameters
     auto tmp1_34 = tmp1_33*x4;
     auto tmp3_69 = tmp3_57 + tmp3_66-tmp1_34-tmp3_60;
     auto tmp3_70 = x1*tmp3_69;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_70))));
     auto tmp3_71 = tmp3_19 + t;
     auto tmp3_72 = tmp3_71*x2;
     auto tmp3_73 = tmp3_61-t;
@@ -159,6 +161,7 @@ void sector_1_order_0_maximal_allowed_deformation_parameters
     auto tmp3_99 = tmp3_73 + tmp3_74;
     auto tmp3_100 = tmp1_31*x2*tmp3_99;
     auto tmp3_101 = tmp3_98 + tmp3_100 + tmp3_76;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_101))));
     auto tmp3_102 = tmp3_68-tmp3_67;
     auto tmp3_103 = x4*tmp3_102;
     auto tmp3_104 = x3*t;
@@ -198,6 +201,7 @@ void sector_1_order_0_maximal_allowed_deformation_parameters
     auto tmp3_138 = tmp3_137 + tmp3_131;
     auto tmp3_139 = msq*tmp3_138;
     auto tmp3_140 = tmp3_139 + tmp3_113;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_140))));
     auto tmp3_141 = -tmp1_10*tmp1_1;
     auto tmp3_142 = tmp3_141-tmp3_115;
     auto tmp3_143 = x4*tmp3_142;
@@ -220,6 +224,7 @@ void sector_1_order_0_maximal_allowed_deformation_parameters
     auto tmp3_160 = x1*tmp3_159;
     auto tmp3_161 = tmp3_111*tmp3_153;
     auto tmp3_162 = tmp3_156 + tmp3_161 + tmp3_160;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_162))));
     auto tmp3_163 = -x5*tmp1_23;
     auto tmp3_164 = -tmp3_82 + tmp3_163;
     auto tmp3_165 = x5*tmp3_164;
@@ -256,11 +261,6 @@ void sector_1_order_0_maximal_allowed_deformation_parameters
     auto tmp3_196 = tmp3_195-tmp3_72 + tmp3_194;
     auto tmp3_197 = x5*tmp3_196;
     auto tmp3_198 = tmp3_187 + tmp3_197 + tmp3_193;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_70))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_101))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_140))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_162))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_198))));
 }
 }
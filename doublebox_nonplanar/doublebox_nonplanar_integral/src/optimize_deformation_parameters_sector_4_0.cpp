@@ -59,6 +59,7 @@ void sector_4_order_0_maximal_allowed_deformation_parameters
     auto tmp3_26 = tmp3_22 + tmp3_25;
     auto tmp3_27 = x0*tmp3_26;
     auto tmp3_28 = tmp3_18 + tmp3_27;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
     auto tmp3_29 = x0 + 1;
     auto tmp3_30 = tmp3_29*x5;
     auto tmp3_31 = tmp3_29*x3;
@@ -120,6 +121,7 @@ void sector_4_order_0_maximal_allowed_deformation_parameters
     auto tmp1_35 = tmp3_64*x2;
     auto tmp3_65 = tmp3_54 + tmp3_62-tmp1_31-tmp1_35;
     auto tmp3_66 = x1*tmp3_65;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_66))));
     auto tmp3_67 = -x5-tmp1_1;
     auto tmp1_36 = 1 + 3*x0;
     auto tmp3_68 = tmp1_36*tmp3_67;
@@ -157,6 +159,7 @@ void sector_4_order_0_maximal_allowed_deformation_parameters
     auto tmp3_100 = tmp3_56*x3;
     auto tmp3_101 = tmp3_100*tmp3_89;
     auto tmp3_102 = tmp3_92 + tmp3_101 + tmp3_99;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_102))));
     auto tmp3_103 = x2*x3;
     auto tmp3_104 = x4*x3;
     auto tmp3_105 = tmp3_103 + tmp3_104;
@@ -194,6 +197,7 @@ void sector_4_order_0_maximal_allowed_deformation_parameters
     auto tmp3_137 = -tmp3_136 + tmp3_135;
     auto tmp3_138 = x3*tmp3_137;
     auto tmp3_139 = tmp3_128 + tmp3_133 + tmp3_138 + tmp3_130;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_139))));
     auto tmp3_140 = x4-1;
     auto tmp3_141 = tmp3_140*tmp1_33;
     auto tmp3_142 = tmp3_141 + tmp1_31-tmp1_30;
@@ -225,6 +229,7 @@ void sector_4_order_0_maximal_allowed_deformation_parameters
     auto tmp3_168 = -tmp3_100 + tmp3_167;
     auto tmp3_169 = x4*tmp3_168;
     auto tmp3_170 = tmp3_166 + tmp3_169 + tmp3_147;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_170))));
     auto tmp3_171 = x5-1;
     auto tmp3_172 = tmp3_171*tmp3_19;
     auto tmp3_173 = SecDecInternalSqr(x5);
@@ -258,11 +263,6 @@ void sector_4_order_0_maximal_allowed_deformation_parameters
     auto tmp3_201 = tmp3_19*tmp3_200;
     auto tmp3_202 = x1*x5*tmp3_199;
     auto tmp3_203 = tmp3_197 + tmp3_202 + tmp3_201;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_66))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_102))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_139))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_170))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_203))));
 }
 }
@@ -70,6 +70,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_31 = tmp3_30 + tmp3_29;
     auto tmp3_32 = x1*x0*tmp3_31;
     auto tmp3_33 = tmp3_24 + tmp3_27 + tmp3_32;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_33))));
     auto tmp3_34 = x2-1;
     auto tmp3_35 = tmp3_34*tmp1_11;
     auto tmp3_36 = 1 + 3*x2;
@@ -137,6 +138,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp1_32 = tmp1_31*x5;
     auto tmp3_85 = tmp3_72 + tmp3_82-tmp1_32-tmp3_74;
     auto tmp3_86 = x1*tmp3_85;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_86))));
     auto tmp3_87 = tmp3_34*x2;
     auto tmp3_88 = tmp3_87*x3;
     auto tmp3_89 = SecDecInternalSqr(x2);
@@ -168,6 +170,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_114 = tmp3_110 + tmp3_113;
     auto tmp3_115 = x1*tmp3_114;
     auto tmp3_116 = tmp3_115 + tmp3_109;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_116))));
     auto tmp3_117 = -x3*tmp1_23;
     auto tmp3_118 = tmp3_117-x2-tmp3_28;
     auto tmp3_119 = x3*tmp3_118;
@@ -204,6 +207,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_150 = tmp3_149*tmp1_29;
     auto tmp3_151 = x5*tmp3_147;
     auto tmp3_152 = tmp3_143 + tmp3_150 + tmp3_151 + tmp3_145 + tmp3_148;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_152))));
     auto tmp3_153 = tmp1_17*x3;
     auto tmp3_154 = tmp1_1 + tmp3_153 + tmp3_64;
     auto tmp3_155 = -x4*tmp3_154;
@@ -236,6 +240,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_182 = x1*tmp3_181;
     auto tmp3_183 = tmp3_76*tmp3_172;
     auto tmp3_184 = tmp3_175 + tmp3_183 + tmp3_182;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_184))));
     auto tmp3_185 = -tmp3_60*tmp1_8;
     auto tmp3_186 = tmp3_185-tmp3_154;
     auto tmp3_187 = x5*tmp3_186;
@@ -258,11 +263,6 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_204 = x1*tmp3_203;
     auto tmp3_205 = tmp3_76*tmp3_197;
     auto tmp3_206 = tmp3_200 + tmp3_205 + tmp3_204;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_33))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_86))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_116))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_152))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_184))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_206))));
 }
 }
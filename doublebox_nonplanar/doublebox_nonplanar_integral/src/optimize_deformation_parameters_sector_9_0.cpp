@@ -58,6 +58,7 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_25 = tmp3_20 + tmp3_24;
     auto tmp3_26 = x5*tmp3_25;
     auto tmp3_27 = tmp3_26 + tmp3_19;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
     auto tmp3_28 = x0 + 1;
     auto tmp3_29 = tmp3_28*x1;
     auto tmp1_13 = tmp3_29-tmp3_28;
@@ -105,6 +106,7 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_60 = tmp3_59 + tmp3_58;
     auto tmp3_61 = x5*x1*tmp3_60;
     auto tmp3_62 = tmp3_54 + tmp3_57 + tmp3_61;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_62))));
     auto tmp3_63 = tmp3_28 + x3;
     auto tmp3_64 = tmp3_63*tmp3_7;
     auto tmp3_65 = tmp3_64 + tmp3_38;
@@ -146,6 +148,7 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_91 = x5*tmp3_90;
     auto tmp3_92 = tmp1_30*tmp1_28;
     auto tmp3_93 = tmp3_86 + tmp3_92 + tmp3_91;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_93))));
     auto tmp3_94 = x1 + 1;
     auto tmp3_95 = -x3*tmp3_94;
     auto tmp3_96 = tmp3_95-x0-tmp1_7;
@@ -186,6 +189,7 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_129 = tmp3_128*tmp1_27;
     auto tmp3_130 = x2*tmp3_126;
     auto tmp3_131 = tmp3_122 + tmp3_129 + tmp3_130 + tmp3_124 + tmp3_127;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_131))));
     auto tmp3_132 = tmp3_67 + tmp3_38;
     auto tmp3_133 = -x4*tmp3_68;
     auto tmp3_134 = tmp3_133 + tmp3_132;
@@ -213,6 +217,7 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_156 = x5*tmp3_155;
     auto tmp3_157 = tmp1_30*tmp3_146;
     auto tmp3_158 = tmp3_149 + tmp3_157 + tmp3_156;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_158))));
     auto tmp3_159 = tmp1_1*tmp3_9;
     auto tmp3_160 = 1 + 3*x0;
     auto tmp3_161 = tmp3_159 + tmp3_160 + tmp3_66;
@@ -258,11 +263,6 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_201 = tmp1_33*x2;
     auto tmp3_202 = tmp3_192 + tmp3_200-tmp3_201-tmp3_193;
     auto tmp3_203 = x5*tmp3_202;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_62))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_93))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_131))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_158))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_203))));
 }
 }
@@ -14,5 +14,27 @@ get_device_sector_3_order_0_integrand,
 #endif
 sector_3_order_0_contour_deformation_polynomial,sector_3_order_0_maximal_allowed_deformation_parameters}},true,"eps"};
 }
+#ifndef SECDEC_WITH_CUDA
+nested_series_t<batch_integrand_t*> get_batch_integrand_of_sector_3()
+{
+return {0,0,{sector_3_order_0_integrand_batch},true,"eps"};
+}
+nested_series_t<checked_integrand_t*> get_checked_integrand_of_sector_3()
+{
+return {0,0,{sector_3_order_0_integrand_with_sign_checks},true,"eps"};
+}
+nested_series_t<contour_deformation_prefix_t> get_contour_deformation_prefix_of_sector_3()
+{
+return {0,0,{{6,sector_3_order_0_contour_deformation_polynomial_prefix_size,sector_3_order_0_contour_deformation_polynomial_prefix,sector_3_order_0_contour_deformation_polynomial_from_prefix,sector_3_order_0_maximal_allowed_deformation_parameters}},true,"eps"};
+}
+nested_series_t<sector_container_t> get_presampled_integrand_of_sector_3()
+{
+return {0,0,{{3,{0},6,sector_3_order_0_integrand,
+#ifdef SECDEC_WITH_CUDA
+get_device_sector_3_order_0_integrand,
+#endif
+sector_3_order_0_contour_deformation_polynomial,presampled_deformation_parameters}},true,"eps"};
+}
+#endif
 
 }
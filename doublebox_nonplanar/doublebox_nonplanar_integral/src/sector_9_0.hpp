@@ -9,6 +9,10 @@ namespace doublebox_nonplanar_integral
 __host__ __device__
 #endif
 secdecutil::SectorContainerWithDeformation<real_t, complex_t>::DeformedIntegrandFunction sector_9_order_0_integrand;
+#ifndef SECDEC_WITH_CUDA
+batch_integrand_t sector_9_order_0_integrand_batch;
+checked_integrand_t sector_9_order_0_integrand_with_sign_checks;
+#endif
 #ifdef SECDEC_WITH_CUDA
 secdecutil::SectorContainerWithDeformation<real_t, complex_t>::DeformedIntegrandFunction* get_device_sector_9_order_0_integrand();
 #endif
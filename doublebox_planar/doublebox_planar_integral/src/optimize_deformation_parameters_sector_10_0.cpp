@@ -19,6 +19,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_21 = s + t;
     auto tmp1_1 = x3*x0;
     auto tmp1_2 = x0-1;
     auto tmp1_3 = tmp1_1*tmp1_2;
@@ -46,7 +47,6 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_18 = tmp3_17*tmp3_13;
     auto tmp3_19 = 2*tmp3_18 + tmp3_10;
     auto tmp3_20 = msq*tmp3_19;
-    auto tmp3_21 = s + t;
     auto tmp3_22 = tmp3_21*x0;
     auto tmp3_23 = -tmp3_22 + tmp3_21;
     auto tmp3_24 = x2*tmp3_23*tmp1_1;
@@ -56,6 +56,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_26 = tmp3_25 + tmp3_24;
     auto tmp3_27 = x5*tmp3_26;
     auto tmp3_28 = tmp3_27 + tmp3_20;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
     auto tmp3_29 = x1-1;
     auto tmp3_30 = tmp3_29*x1;
     auto tmp1_10 = tmp3_30*x3;
@@ -88,6 +89,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_54 = tmp3_53-s;
     auto tmp3_55 = tmp3_54*tmp3_52;
     auto tmp3_56 = tmp3_50 + tmp3_55;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_56))));
     auto tmp3_57 = tmp3_21*tmp1_1;
     auto tmp3_58 = tmp3_57-s;
     auto tmp3_59 = tmp3_53*x4;
@@ -144,6 +146,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_92 = msq*tmp3_91;
     auto tmp3_93 = tmp3_53*tmp3_89;
     auto tmp3_94 = tmp3_92 + tmp3_93 + tmp3_65;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_94))));
     auto tmp3_95 = -tmp3_66*tmp3_73;
     auto tmp3_96 = tmp1_19-tmp3_66;
     auto tmp3_97 = -x4*tmp3_96;
@@ -169,6 +172,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_116 = tmp3_113 + tmp3_115;
     auto tmp3_117 = x3*tmp3_116;
     auto tmp3_118 = tmp3_112 + tmp3_117;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_118))));
     auto tmp3_119 = s + tmp1_8 + tmp3_53;
     auto tmp3_120 = tmp3_119*x4;
     auto tmp3_121 = tmp3_59-tmp3_53;
@@ -199,6 +203,7 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_146 = tmp3_145 + tmp3_144;
     auto tmp3_147 = msq*tmp3_146;
     auto tmp3_148 = tmp3_147 + tmp3_128;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_148))));
     auto tmp3_149 = -2*s + tmp3_53;
     auto tmp3_150 = x4*tmp3_149;
     auto tmp3_151 = tmp3_150-tmp3_58;
@@ -233,11 +238,6 @@ void sector_10_order_0_maximal_allowed_deformation_parameters
     auto tmp3_180 = msq*tmp3_179;
     auto tmp3_181 = tmp3_180 + tmp3_156-tmp3_120 + tmp3_61;
     auto tmp3_182 = x5*tmp3_181;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_56))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_94))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_118))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_148))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_182))));
 }
 }
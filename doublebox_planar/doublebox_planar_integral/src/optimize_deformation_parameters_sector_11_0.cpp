@@ -19,6 +19,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_20 = s + t;
     auto tmp1_1 = x0-1;
     auto tmp1_2 = x4*x0;
     auto tmp1_3 = tmp1_1*tmp1_2;
@@ -46,7 +47,6 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_17 = tmp3_15*tmp3_16;
     auto tmp3_18 = 2*tmp3_17 + tmp3_10;
     auto tmp3_19 = msq*tmp3_18;
-    auto tmp3_20 = s + t;
     auto tmp3_21 = -x2*tmp3_20*tmp1_3;
     auto tmp3_22 = x0*s;
     auto tmp3_23 = -s + tmp3_22;
@@ -54,6 +54,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_25 = tmp3_24 + tmp3_21;
     auto tmp3_26 = x5*tmp3_25;
     auto tmp3_27 = tmp3_26 + tmp3_19;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
     auto tmp3_28 = x1-1;
     auto tmp3_29 = tmp3_28*x1;
     auto tmp3_30 = tmp3_29*x4;
@@ -87,6 +88,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_55 = tmp3_54-s;
     auto tmp3_56 = tmp3_55*tmp3_53;
     auto tmp3_57 = tmp3_51 + tmp3_56;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_57))));
     auto tmp3_58 = tmp1_11 + x1;
     auto tmp3_59 = tmp3_58*x3;
     auto tmp1_12 = tmp3_58*x4;
@@ -139,6 +141,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_90 = x5*tmp3_89;
     auto tmp3_91 = tmp3_54*tmp1_24;
     auto tmp3_92 = tmp3_85 + tmp3_91 + tmp3_90;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_92))));
     auto tmp3_93 = tmp3_74 + x2;
     auto tmp3_94 = tmp3_86-s;
     auto tmp3_95 = tmp3_94*tmp3_93;
@@ -169,6 +172,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_118 = msq*tmp3_117;
     auto tmp3_119 = tmp3_54*tmp3_115;
     auto tmp3_120 = tmp3_118 + tmp3_119 + tmp3_99;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_120))));
     auto tmp3_121 = -tmp3_58*tmp3_66;
     auto tmp3_122 = tmp1_12-tmp3_58;
     auto tmp3_123 = -x3*tmp3_122;
@@ -195,6 +199,7 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_144 = tmp3_140 + tmp3_143;
     auto tmp3_145 = x4*tmp3_144;
     auto tmp3_146 = tmp3_139 + tmp3_145;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_146))));
     auto tmp3_147 = -tmp3_86-tmp1_26;
     auto tmp3_148 = x2*tmp3_147;
     auto tmp3_149 = 2*tmp3_74;
@@ -228,11 +233,6 @@ void sector_11_order_0_maximal_allowed_deformation_parameters
     auto tmp3_177 = tmp1_27*x2;
     auto tmp3_178 = tmp3_176 + tmp3_152-tmp3_97 + tmp3_177;
     auto tmp3_179 = x5*tmp3_178;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_57))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_92))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_120))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_146))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_179))));
 }
 }
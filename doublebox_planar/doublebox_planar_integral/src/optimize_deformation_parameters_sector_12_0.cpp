@@ -19,6 +19,7 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp1_8 = s + t;
     auto tmp1_1 = x0-1;
     auto tmp3_1 = tmp1_1*x0;
     auto tmp1_2 = tmp3_1*x3;
@@ -48,13 +49,13 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     auto tmp3_21 = x0*s;
     auto tmp1_7 = -s + tmp3_21;
     auto tmp3_22 = tmp1_7*tmp3_20;
-    auto tmp1_8 = s + t;
     auto tmp1_9 = tmp1_8*x0;
     auto tmp3_23 = -tmp1_9 + tmp1_8;
     auto tmp3_24 = x2*tmp3_23;
     auto tmp3_25 = tmp3_22 + tmp3_24;
     auto tmp3_26 = x5*x0*tmp3_25;
     auto tmp3_27 = tmp3_26 + tmp3_19;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
     auto tmp3_28 = x1-1;
     auto tmp3_29 = tmp3_28*x1;
     auto tmp1_10 = tmp3_29*x3;
@@ -90,6 +91,7 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     auto tmp3_54 = x5*tmp3_53;
     auto tmp3_55 = tmp1_14*tmp3_15;
     auto tmp3_56 = tmp3_48 + tmp3_54 + tmp3_51 + tmp3_55;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_56))));
     auto tmp3_57 = tmp3_44 + x1;
     auto tmp3_58 = tmp3_57*x3;
     auto tmp3_59 = tmp3_57*x4;
@@ -142,6 +144,7 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     auto tmp3_92 = x5*tmp3_91;
     auto tmp3_93 = tmp3_49*tmp1_24;
     auto tmp3_94 = tmp3_87 + tmp3_93 + tmp3_92;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_94))));
     auto tmp3_95 = tmp3_21 + tmp3_49 + s;
     auto tmp3_96 = tmp3_95*x3;
     auto tmp3_97 = tmp1_26-s;
@@ -172,6 +175,7 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     auto tmp3_118 = msq*tmp3_117;
     auto tmp3_119 = tmp3_49*tmp3_115;
     auto tmp3_120 = tmp3_118 + tmp3_119 + tmp3_103;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_120))));
     auto tmp3_121 = tmp3_95*tmp3_20;
     auto tmp3_122 = tmp1_27-tmp3_49;
     auto tmp3_123 = x2*tmp3_122;
@@ -202,6 +206,7 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     auto tmp3_148 = tmp3_147 + tmp3_146;
     auto tmp3_149 = msq*tmp3_148;
     auto tmp3_150 = tmp3_149 + tmp3_129;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_150))));
     auto tmp3_151 = tmp3_49-2*tmp1_26;
     auto tmp3_152 = x4*tmp3_151;
     auto tmp3_153 = tmp3_152-tmp3_90;
@@ -237,11 +242,6 @@ void sector_12_order_0_maximal_allowed_deformation_parameters
     auto tmp3_183 = tmp1_28*x2;
     auto tmp3_184 = tmp3_182 + tmp3_158-tmp3_121 + tmp3_183;
     auto tmp3_185 = x5*tmp3_184;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_56))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_94))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_120))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_150))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_185))));
 }
 }
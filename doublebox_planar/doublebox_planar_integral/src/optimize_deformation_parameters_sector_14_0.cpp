@@ -86,6 +86,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_36 = tmp3_35*x2;
     auto tmp3_37 = tmp3_33 + tmp3_5-tmp1_10 + tmp3_36;
     auto tmp3_38 = x0*tmp3_37;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_38))));
     auto tmp3_39 = tmp1_8*x1;
     auto tmp3_40 = tmp1_3-s;
     auto tmp1_30 = tmp3_40*tmp1_11;
@@ -122,6 +123,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_66 = msq*tmp3_65;
     auto tmp3_67 = tmp1_5*tmp3_63;
     auto tmp3_68 = tmp3_66 + tmp3_67 + tmp3_46;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_68))));
     auto tmp3_69 = tmp1_22 + tmp3_15;
     auto tmp3_70 = -x2*tmp1_24;
     auto tmp3_71 = tmp3_70-tmp3_14-3*tmp3_69;
@@ -147,6 +149,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_91 = x0*tmp3_90;
     auto tmp3_92 = tmp1_5*tmp3_84;
     auto tmp3_93 = tmp3_87 + tmp3_92 + tmp3_91;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_93))));
     auto tmp3_94 = x3-1;
     auto tmp3_95 = tmp3_94*x3;
     auto tmp3_96 = tmp3_95*x1;
@@ -180,6 +183,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_124 = x0*tmp3_123;
     auto tmp3_125 = tmp3_119*tmp3_110;
     auto tmp3_126 = tmp3_117 + tmp3_124 + tmp3_121 + tmp3_125;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_126))));
     auto tmp3_127 = tmp3_34-tmp1_5;
     auto tmp3_128 = x2*tmp3_127;
     auto tmp3_129 = -tmp1_3 + tmp1_13;
@@ -208,6 +212,7 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_152 = tmp3_151 + tmp3_150;
     auto tmp3_153 = msq*tmp3_152;
     auto tmp3_154 = tmp3_153 + tmp3_134;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_154))));
     auto tmp3_155 = x5-1;
     auto tmp3_156 = tmp3_155*x5;
     auto tmp3_157 = tmp3_156*x1;
@@ -237,11 +242,6 @@ void sector_14_order_0_maximal_allowed_deformation_parameters
     auto tmp3_181 = tmp3_178 + tmp3_180;
     auto tmp3_182 = x0*x5*tmp3_181;
     auto tmp3_183 = tmp3_182 + tmp3_176;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_38))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_68))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_93))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_126))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_154))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_183))));
 }
 }
@@ -85,6 +85,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_37 = tmp3_36*x2;
     auto tmp3_38 = tmp3_34 + tmp3_5-tmp1_5-tmp3_37;
     auto tmp3_39 = x0*tmp3_38;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_39))));
     auto tmp3_40 = tmp1_3*x1;
     auto tmp3_41 = -s + tmp1_6;
     auto tmp3_42 = tmp3_41*tmp1_10;
@@ -125,6 +126,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_72 = -tmp3_71 + tmp3_70;
     auto tmp3_73 = x1*tmp3_72;
     auto tmp3_74 = tmp3_68 + tmp3_73 + tmp3_49;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_74))));
     auto tmp3_75 = tmp1_21 + tmp3_15;
     auto tmp3_76 = -x2*tmp1_23;
     auto tmp3_77 = tmp3_76-tmp3_14-3*tmp3_75;
@@ -150,6 +152,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_97 = x0*tmp3_96;
     auto tmp3_98 = tmp3_71*tmp3_90;
     auto tmp3_99 = tmp3_93 + tmp3_98 + tmp3_97;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_99))));
     auto tmp3_100 = x3-1;
     auto tmp3_101 = tmp3_100*x3;
     auto tmp3_102 = tmp3_101*x1;
@@ -184,6 +187,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_131 = tmp1_2-s;
     auto tmp3_132 = tmp3_131*tmp3_130;
     auto tmp3_133 = tmp3_125 + tmp3_132;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_133))));
     auto tmp3_134 = -tmp1_6 + tmp1_12;
     auto tmp3_135 = tmp3_134*tmp1_10;
     auto tmp3_136 = tmp3_135-tmp3_40 + tmp1_5;
@@ -213,6 +217,7 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_160 = msq*tmp3_159;
     auto tmp3_161 = tmp3_71*tmp3_157;
     auto tmp3_162 = tmp3_160 + tmp3_161 + tmp3_141;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_162))));
     auto tmp3_163 = x5-1;
     auto tmp3_164 = tmp3_163*tmp3_69;
     auto tmp3_165 = tmp3_163*x5;
@@ -241,11 +246,6 @@ void sector_15_order_0_maximal_allowed_deformation_parameters
     auto tmp3_188 = tmp1_1-s;
     auto tmp3_189 = x0*tmp3_69*tmp3_188*tmp3_187;
     auto tmp3_190 = tmp3_184 + tmp3_189 + tmp3_186;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_39))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_74))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_99))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_133))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_162))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_190))));
 }
 }
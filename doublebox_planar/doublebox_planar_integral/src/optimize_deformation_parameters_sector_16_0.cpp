@@ -19,6 +19,7 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_133 = s + t;
     auto tmp1_1 = x0-1;
     auto tmp1_2 = x2*x0;
     auto tmp1_3 = tmp1_1*tmp1_2;
@@ -71,6 +72,7 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     auto tmp3_31 = x5*x4;
     auto tmp3_32 = tmp3_31*x0*tmp3_30;
     auto tmp3_33 = tmp3_23 + tmp3_32 + tmp3_29;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_33))));
     auto tmp3_34 = x2*s;
     auto tmp3_35 = tmp3_34 + tmp3_27;
     auto tmp1_20 = tmp3_35 + s;
@@ -121,6 +123,7 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     auto tmp3_64 = tmp3_63 + tmp3_57;
     auto tmp3_65 = msq*tmp3_64;
     auto tmp3_66 = tmp3_65 + tmp3_43;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_66))));
     auto tmp3_67 = -x2*tmp1_6;
     auto tmp3_68 = -tmp1_7 + tmp3_67;
     auto tmp3_69 = x2*tmp3_68;
@@ -159,6 +162,7 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     auto tmp3_102 = tmp3_101-tmp3_26 + tmp3_100;
     auto tmp3_103 = x2*tmp3_102;
     auto tmp3_104 = tmp3_93 + tmp3_103 + tmp3_99;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_104))));
     auto tmp3_105 = 2*x4;
     auto tmp3_106 = tmp3_105 + tmp1_11;
     auto tmp3_107 = x3-1;
@@ -188,13 +192,13 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     auto tmp3_130 = msq*tmp3_129;
     auto tmp3_131 = -s + tmp3_24;
     auto tmp3_132 = tmp3_131*tmp1_2;
-    auto tmp3_133 = s + t;
     auto tmp3_134 = tmp3_133*x3;
     auto tmp3_135 = -tmp3_134 + tmp3_133;
     auto tmp3_136 = x5*tmp3_135;
     auto tmp3_137 = tmp3_132 + tmp3_136;
     auto tmp3_138 = x3*tmp3_137;
     auto tmp3_139 = tmp3_130 + tmp3_138;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_139))));
     auto tmp3_140 = tmp1_32 + tmp1_30;
     auto tmp3_141 = -tmp3_105-tmp1_28;
     auto tmp3_142 = tmp1_27*tmp3_141;
@@ -220,6 +224,7 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     auto tmp3_162 = x5*tmp3_161;
     auto tmp3_163 = tmp1_26*tmp3_154;
     auto tmp3_164 = tmp3_157 + tmp3_163 + tmp3_162;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_164))));
     auto tmp3_165 = tmp3_47-tmp1_35;
     auto tmp3_166 = tmp3_70-1;
     auto tmp3_167 = -tmp3_166*tmp1_12;
@@ -257,11 +262,6 @@ void sector_16_order_0_maximal_allowed_deformation_parameters
     auto tmp3_199 = tmp3_159*x4;
     auto tmp3_200 = tmp3_190 + tmp3_198-tmp3_199-tmp3_191;
     auto tmp3_201 = x5*tmp3_200;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_33))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_66))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_104))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_139))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_164))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_201))));
 }
 }
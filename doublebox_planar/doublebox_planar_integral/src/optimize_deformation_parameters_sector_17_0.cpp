@@ -19,31 +19,20 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
-    auto tmp1_1 = x1*x0;
-    auto tmp1_2 = x4*x0;
-    auto tmp1_3 = tmp1_1 + tmp1_2;
-    auto tmp1_4 = x0 + x2;
-    auto tmp1_5 = tmp1_4*x0;
-    auto tmp1_6 = x2 + 1;
-    auto tmp3_1 = tmp1_5-tmp1_6;
-    auto tmp3_2 = -tmp3_1*tmp1_3;
+    auto tmp3_65 = s + t;
     auto tmp1_7 = x3 + 1;
-    auto tmp1_8 = tmp1_7*x2;
     auto tmp1_9 = tmp1_7*x0;
-    auto tmp1_10 = tmp1_9 + tmp1_8;
-    auto tmp1_11 = -x0*tmp1_10;
-    auto tmp3_3 = tmp1_11 + tmp1_8 + tmp1_7;
-    auto tmp3_4 = x0*tmp3_3;
-    auto tmp3_5 = tmp3_4 + tmp3_2;
     auto tmp3_6 = tmp1_9-tmp1_7;
     auto tmp3_7 = tmp3_6*x0;
+    auto tmp1_2 = x4*x0;
     auto tmp3_8 = x0-1;
     auto tmp1_12 = tmp3_8*tmp1_2;
     auto tmp1_13 = -2*tmp3_7-tmp1_12;
-    auto tmp3_9 = x4*tmp1_13;
     auto tmp3_10 = -tmp3_7-tmp1_12;
+    auto tmp1_1 = x1*x0;
     auto tmp3_11 = -tmp3_8*tmp1_1;
     auto tmp3_12 = 3*tmp3_10 + tmp3_11;
+    auto tmp3_9 = x4*tmp1_13;
     auto tmp3_13 = x1*tmp3_12;
     auto tmp3_14 = x3 + 2;
     auto tmp3_15 = tmp3_14*x3;
@@ -52,9 +41,20 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_18 = -tmp3_17 + tmp3_16;
     auto tmp3_19 = x0*tmp3_18;
     auto tmp3_20 = tmp3_13 + tmp3_19 + tmp3_9;
+    auto tmp1_3 = tmp1_1 + tmp1_2;
+    auto tmp1_4 = x0 + x2;
+    auto tmp1_5 = tmp1_4*x0;
+    auto tmp1_6 = x2 + 1;
+    auto tmp3_1 = tmp1_5-tmp1_6;
+    auto tmp3_2 = -tmp3_1*tmp1_3;
+    auto tmp1_8 = tmp1_7*x2;
+    auto tmp1_10 = tmp1_9 + tmp1_8;
+    auto tmp1_11 = -x0*tmp1_10;
+    auto tmp3_3 = tmp1_11 + tmp1_8 + tmp1_7;
+    auto tmp3_4 = x0*tmp3_3;
+    auto tmp3_5 = tmp3_4 + tmp3_2;
     auto tmp3_21 = x5*tmp3_20;
     auto tmp3_22 = 2*tmp3_5 + tmp3_21;
-    auto tmp3_23 = msq*tmp3_22;
     auto tmp3_24 = x2*s;
     auto tmp3_25 = tmp3_24*x0;
     auto tmp3_26 = tmp3_25-tmp3_24;
@@ -63,6 +63,7 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp1_14 = x0*s;
     auto tmp1_15 = tmp1_14-s;
     auto tmp3_29 = x5*tmp1_2*tmp1_15*tmp3_28;
+    auto tmp3_23 = msq*tmp3_22;
     auto tmp3_30 = x3*s;
     auto tmp1_16 = tmp3_30 + s;
     auto tmp1_17 = x0*x2;
@@ -71,7 +72,50 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_31 = -tmp1_19 + tmp1_18;
     auto tmp3_32 = x0*tmp3_31;
     auto tmp3_33 = tmp3_23 + tmp3_29 + tmp3_32 + tmp3_27;
+    auto tmp1_26 = SecDecInternalSqr(x3);
+    auto tmp3_45 = tmp1_26-1;
+    auto tmp3_107 = x3-1;
+    auto tmp3_108 = tmp3_107*x3;
     auto tmp3_34 = x0 + 1;
+    auto tmp3_103 = tmp3_45*x3;
+    auto tmp3_104 = -tmp3_103*tmp3_34;
+    auto tmp3_105 = x2*x3;
+    auto tmp3_106 = -tmp3_45*tmp3_105;
+    auto tmp3_109 = tmp3_108*x2;
+    auto tmp3_110 = tmp3_109 + tmp3_108;
+    auto tmp3_111 = tmp3_108*x0;
+    auto tmp3_112 = tmp3_110 + tmp3_111;
+    auto tmp1_43 = -x4*tmp3_112;
+    auto tmp3_113 = tmp1_43 + tmp3_106 + tmp3_104;
+    auto tmp3_115 = -x4*tmp3_108;
+    auto tmp3_116 = -tmp3_103 + tmp3_115;
+    auto tmp3_117 = -x1*tmp3_108;
+    auto tmp3_118 = 2*tmp3_116 + tmp3_117;
+    auto tmp3_114 = x1*tmp3_112;
+    auto tmp1_29 = x5*x1;
+    auto tmp3_119 = tmp3_118*tmp1_29;
+    auto tmp3_120 = tmp3_119 + 2*tmp3_113-3*tmp3_114;
+    auto tmp3_124 = -2*tmp3_110-tmp3_111;
+    auto tmp3_121 = x5*tmp3_120;
+    auto tmp3_122 = -2*tmp3_108-tmp3_109;
+    auto tmp3_123 = x2*tmp3_122;
+    auto tmp3_125 = x0*tmp3_124;
+    auto tmp3_126 = tmp3_121 + tmp3_125-tmp3_108 + tmp3_123;
+    auto tmp1_24 = tmp1_7 + x4;
+    auto tmp1_25 = 2*x1;
+    auto tmp3_44 = -tmp1_24*tmp1_25;
+    auto tmp1_27 = 2*x3;
+    auto tmp1_28 = -tmp1_27-x4;
+    auto tmp3_46 = x4*tmp1_28;
+    auto tmp3_47 = tmp3_44 + tmp3_46-tmp3_45;
+    auto tmp3_172 = tmp1_27 + 1;
+    auto tmp3_149 = 2*x4;
+    auto tmp3_173 = tmp3_149-tmp1_4 + tmp3_172;
+    auto tmp3_174 = x1*tmp3_173;
+    auto tmp3_175 = tmp3_149 + 1 + 4*x3-3*tmp1_4;
+    auto tmp3_176 = x4*tmp3_175;
+    auto tmp3_177 = x3*tmp3_172;
+    auto tmp3_178 = tmp3_174 + tmp3_176-1 + tmp3_177-3*tmp1_10;
     auto tmp3_35 = -x2-tmp3_34;
     auto tmp3_36 = 1 + 3*x3;
     auto tmp3_37 = tmp3_36*tmp3_35;
@@ -85,35 +129,23 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_41 = 3*tmp1_23;
     auto tmp3_42 = tmp3_41 + tmp3_40;
     auto tmp3_43 = x1*tmp3_42;
-    auto tmp1_24 = tmp1_7 + x4;
-    auto tmp1_25 = 2*x1;
-    auto tmp3_44 = -tmp1_24*tmp1_25;
-    auto tmp1_26 = SecDecInternalSqr(x3);
-    auto tmp3_45 = tmp1_26-1;
-    auto tmp1_27 = 2*x3;
-    auto tmp1_28 = -tmp1_27-x4;
-    auto tmp3_46 = x4*tmp1_28;
-    auto tmp3_47 = tmp3_44 + tmp3_46-tmp3_45;
     auto tmp3_48 = x1*tmp3_47;
     auto tmp3_49 = x4 + 2*tmp1_7;
     auto tmp3_50 = tmp3_49*x4;
     auto tmp3_51 = tmp3_50 + tmp3_16;
     auto tmp3_52 = tmp3_48 + tmp3_51;
-    auto tmp1_29 = x5*x1;
     auto tmp3_53 = tmp3_52*tmp1_29;
     auto tmp3_54 = tmp3_43 + tmp3_53;
-    auto tmp3_55 = x5*tmp3_54;
     auto tmp3_56 = x0 + 2*tmp1_6;
     auto tmp3_57 = tmp3_56*x0;
     auto tmp3_58 = x2 + 2;
     auto tmp3_59 = tmp3_58*x2;
     auto tmp3_60 = tmp3_57 + tmp3_59 + 1;
+    auto tmp3_55 = x5*tmp3_54;
     auto tmp3_61 = x1-1;
     auto tmp3_62 = tmp3_61*x1;
     auto tmp1_30 = -tmp3_60*tmp3_62;
     auto tmp3_63 = tmp1_30 + tmp3_55;
-    auto tmp3_64 = msq*tmp3_63;
-    auto tmp3_65 = s + t;
     auto tmp1_31 = tmp3_65*x3;
     auto tmp1_32 = tmp1_31-tmp3_24;
     auto tmp1_33 = tmp1_14*x4;
@@ -126,14 +158,15 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp1_38 = -x4 + tmp1_37;
     auto tmp3_68 = tmp1_38*tmp1_36;
     auto tmp3_69 = tmp3_67 + tmp3_68;
+    auto tmp3_64 = msq*tmp3_63;
     auto tmp3_70 = x5*tmp3_69;
     auto tmp3_71 = tmp3_25*tmp3_62;
     auto tmp3_72 = tmp3_64 + tmp3_71 + tmp3_70;
-    auto tmp3_73 = x2-1;
-    auto tmp3_74 = tmp3_73*tmp1_17;
     auto tmp3_75 = SecDecInternalSqr(x2);
     auto tmp3_76 = tmp3_75-1;
     auto tmp3_77 = tmp3_76*x2;
+    auto tmp3_73 = x2-1;
+    auto tmp3_74 = tmp3_73*tmp1_17;
     auto tmp3_78 = tmp3_77 + tmp3_74;
     auto tmp1_39 = x1 + x4;
     auto tmp3_79 = -tmp3_78*tmp1_39;
@@ -141,129 +174,96 @@ void sector_17_order_0_maximal_allowed_deformation_parameters
     auto tmp3_81 = tmp1_8-tmp1_7;
     auto tmp1_40 = -tmp3_81*tmp1_17;
     auto tmp3_82 = tmp3_80 + tmp1_40 + tmp3_79;
+    auto tmp3_169 = tmp1_21 + 2*tmp1_22;
+    auto tmp3_170 = tmp3_169*x4;
     auto tmp3_83 = tmp3_16*x2;
+    auto tmp3_171 = tmp3_170 + tmp3_16 + tmp3_83 + tmp3_17;
     auto tmp3_84 = -tmp3_83 + tmp3_16;
-    auto tmp3_85 = x2*tmp3_84;
     auto tmp3_86 = tmp3_81*x2;
     auto tmp3_87 = tmp3_73*x2;
     auto tmp1_41 = tmp3_87*x4;
     auto tmp1_42 = -2*tmp3_86-tmp1_41;
-    auto tmp3_88 = x4*tmp1_42;
     auto tmp3_89 = -tmp3_86-tmp1_41;
     auto tmp3_90 = -x1*tmp3_87;
     auto tmp3_91 = 3*tmp3_89 + tmp3_90;
+    auto tmp3_85 = x2*tmp3_84;
+    auto tmp3_88 = x4*tmp1_42;
     auto tmp3_92 = x1*tmp3_91;
     auto tmp3_93 = tmp3_92 + tmp3_85 + tmp3_88;
     auto tmp3_94 = x5*tmp3_93;
     auto tmp3_95 = 2*tmp3_82 + tmp3_94;
-    auto tmp3_96 = msq*tmp3_95;
     auto tmp3_97 = tmp3_24-s;
     auto tmp3_98 = tmp3_97*tmp1_39;
     auto tmp3_99 = tmp3_98 + tmp1_19-tmp1_16;
+    auto tmp3_96 = msq*tmp3_95;
     auto tmp3_100 = tmp1_17*tmp3_99;
     auto tmp3_101 = x5*x2*tmp3_98;
     auto tmp3_102 = tmp3_96 + tmp3_101 + tmp3_100;
-    auto tmp3_103 = tmp3_45*x3;
-    auto tmp3_104 = -tmp3_103*tmp3_34;
-    auto tmp3_105 = x2*x3;
-    auto tmp3_106 = -tmp3_45*tmp3_105;
-    auto tmp3_107 = x3-1;
-    auto tmp3_108 = tmp3_107*x3;
-    auto tmp3_109 = tmp3_108*x2;
-    auto tmp3_110 = tmp3_109 + tmp3_108;
-    auto tmp3_111 = tmp3_108*x0;
-    auto tmp3_112 = tmp3_110 + tmp3_111;
-    auto tmp1_43 = -x4*tmp3_112;
-    auto tmp3_113 = tmp1_43 + tmp3_106 + tmp3_104;
-    auto tmp3_114 = x1*tmp3_112;
-    auto tmp3_115 = -x4*tmp3_108;
-    auto tmp3_116 = -tmp3_103 + tmp3_115;
-    auto tmp3_117 = -x1*tmp3_108;
-    auto tmp3_118 = 2*tmp3_116 + tmp3_117;
-    auto tmp3_119 = tmp3_118*tmp1_29;
-    auto tmp3_120 = tmp3_119 + 2*tmp3_113-3*tmp3_114;
-    auto tmp3_121 = x5*tmp3_120;
-    auto tmp3_122 = -2*tmp3_108-tmp3_109;
-    auto tmp3_123 = x2*tmp3_122;
-    auto tmp3_124 = -2*tmp3_110-tmp3_111;
-    auto tmp3_125 = x0*tmp3_124;
-    auto tmp3_126 = tmp3_121 + tmp3_125-tmp3_108 + tmp3_123;
-    auto tmp3_127 = msq*tmp3_126;
-    auto tmp3_128 = -s + tmp3_30;
-    auto tmp3_129 = tmp3_128*tmp1_17;
-    auto tmp3_130 = -tmp1_31 + tmp3_65;
-    auto tmp3_131 = tmp3_130*tmp1_29;
-    auto tmp3_132 = tmp3_129 + tmp3_131;
-    auto tmp3_133 = x3*tmp3_132;
-    auto tmp3_134 = tmp3_127 + tmp3_133;
+    auto tmp3_180 = -x1*tmp1_24;
+    auto tmp3_181 = tmp3_180-tmp3_51;
+    auto tmp3_179 = x1*tmp3_178;
+    auto tmp3_182 = tmp3_181*tmp1_29;
+    auto tmp3_183 = 2*tmp3_182 + tmp3_179-tmp3_171;
+    auto tmp3_185 = tmp3_41 + tmp1_20;
+    auto tmp3_184 = x5*tmp3_183;
+    auto tmp3_186 = x1*tmp3_185;
+    auto tmp3_187 = tmp3_184 + tmp3_186 + tmp3_171;
+    auto tmp3_189 = -2*s + tmp1_14;
+    auto tmp3_190 = x4*tmp3_189;
+    auto tmp3_191 = tmp3_190-tmp1_32;
+    auto tmp3_192 = x1*tmp3_191;
     auto tmp3_135 = s + tmp1_14 + tmp3_24;
     auto tmp3_136 = tmp3_135*x4;
+    auto tmp3_193 = tmp3_149*tmp1_36;
+    auto tmp3_194 = tmp3_193 + tmp3_136 + tmp3_192;
+    auto tmp3_188 = msq*tmp3_187;
+    auto tmp3_195 = x5*tmp3_194;
+    auto tmp3_196 = tmp3_188 + tmp3_195-tmp3_136 + tmp1_35;
     auto tmp3_137 = x4-1;
     auto tmp3_138 = tmp3_137*tmp1_36;
     auto tmp3_139 = tmp3_138 + tmp3_136-tmp3_135;
-    auto tmp3_140 = x4*tmp3_139;
-    auto tmp3_141 = -tmp1_14 + tmp1_33;
-    auto tmp3_142 = tmp3_141*tmp1_37;
-    auto tmp3_143 = tmp3_142 + tmp3_140;
-    auto tmp3_144 = x5*tmp3_143;
     auto tmp3_145 = -x3*tmp3_34;
     auto tmp3_146 = -tmp1_21-tmp3_105 + tmp3_145;
     auto tmp3_147 = x4*tmp3_146;
     auto tmp3_148 = tmp3_147 + tmp1_22;
-    auto tmp3_149 = 2*x4;
-    auto tmp3_150 = tmp3_148*tmp3_149;
     auto tmp3_151 = -x3-x4;
     auto tmp3_152 = x4*tmp3_151;
     auto tmp3_153 = tmp3_152 + tmp1_7;
+    auto tmp3_150 = tmp3_148*tmp3_149;
     auto tmp3_154 = tmp3_153*tmp3_149;
     auto tmp3_155 = -tmp3_137*tmp1_37;
     auto tmp3_156 = tmp3_154 + tmp3_155;
-    auto tmp3_157 = tmp3_156*tmp1_29;
     auto tmp3_158 = -tmp1_21 + tmp3_38;
+    auto tmp3_157 = tmp3_156*tmp1_29;
     auto tmp3_159 = tmp3_158*tmp1_37;
     auto tmp3_160 = tmp3_157 + tmp3_150 + 3*tmp3_159;
-    auto tmp3_161 = x5*tmp3_160;
+    auto tmp3_141 = -tmp1_14 + tmp1_33;
+    auto tmp3_142 = tmp3_141*tmp1_37;
+    auto tmp3_140 = x4*tmp3_139;
+    auto tmp3_143 = tmp3_142 + tmp3_140;
     auto tmp3_162 = -x4*tmp3_60*tmp3_137;
+    auto tmp3_161 = x5*tmp3_160;
     auto tmp3_163 = tmp3_162 + tmp3_161;
-    auto tmp3_164 = msq*tmp3_163;
     auto tmp3_165 = tmp3_24*tmp1_2;
     auto tmp3_166 = -tmp3_25 + tmp3_165;
+    auto tmp3_144 = x5*tmp3_143;
+    auto tmp3_164 = msq*tmp3_163;
     auto tmp3_167 = x4*tmp3_166;
     auto tmp3_168 = tmp3_164 + tmp3_167 + tmp3_144;
-    auto tmp3_169 = tmp1_21 + 2*tmp1_22;
-    auto tmp3_170 = tmp3_169*x4;
-    auto tmp3_171 = tmp3_170 + tmp3_16 + tmp3_83 + tmp3_17;
-    auto tmp3_172 = tmp1_27 + 1;
-    auto tmp3_173 = tmp3_149-tmp1_4 + tmp3_172;
-    auto tmp3_174 = x1*tmp3_173;
-    auto tmp3_175 = tmp3_149 + 1 + 4*x3-3*tmp1_4;
-    auto tmp3_176 = x4*tmp3_175;
-    auto tmp3_177 = x3*tmp3_172;
-    auto tmp3_178 = tmp3_174 + tmp3_176-1 + tmp3_177-3*tmp1_10;
-    auto tmp3_179 = x1*tmp3_178;
-    auto tmp3_180 = -x1*tmp1_24;
-    auto tmp3_181 = tmp3_180-tmp3_51;
-    auto tmp3_182 = tmp3_181*tmp1_29;
-    auto tmp3_183 = 2*tmp3_182 + tmp3_179-tmp3_171;
-    auto tmp3_184 = x5*tmp3_183;
-    auto tmp3_185 = tmp3_41 + tmp1_20;
-    auto tmp3_186 = x1*tmp3_185;
-    auto tmp3_187 = tmp3_184 + tmp3_186 + tmp3_171;
-    auto tmp3_188 = msq*tmp3_187;
-    auto tmp3_189 = -2*s + tmp1_14;
-    auto tmp3_190 = x4*tmp3_189;
-    auto tmp3_191 = tmp3_190-tmp1_32;
-    auto tmp3_192 = x1*tmp3_191;
-    auto tmp3_193 = tmp3_149*tmp1_36;
-    auto tmp3_194 = tmp3_193 + tmp3_136 + tmp3_192;
-    auto tmp3_195 = x5*tmp3_194;
-    auto tmp3_196 = tmp3_188 + tmp3_195-tmp3_136 + tmp1_35;
-    auto tmp3_197 = x5*tmp3_196;
+    auto tmp3_128 = -s + tmp3_30;
+    auto tmp3_129 = tmp3_128*tmp1_17;
+    auto tmp3_130 = -tmp1_31 + tmp3_65;
+    auto tmp3_131 = tmp3_130*tmp1_29;
+    auto tmp3_132 = tmp3_129 + tmp3_131;
+    auto tmp3_127 = msq*tmp3_126;
+    auto tmp3_133 = x3*tmp3_132;
+    auto tmp3_134 = tmp3_127 + tmp3_133;
     SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_33))));
     SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_72))));
     SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_102))));
     SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_134))));
     SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_168))));
+    auto tmp3_197 = x5*tmp3_196;
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_197))));
 }
 }
@@ -55,6 +55,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp1_7 = tmp3_27-s;
     auto tmp3_28 = tmp1_7*tmp3_26;
     auto tmp3_29 = tmp3_20 + tmp3_28;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_29))));
     auto tmp3_30 = x0 + 1;
     auto tmp3_31 = tmp3_30 + x3;
     auto tmp1_8 = tmp3_31*x2;
@@ -112,6 +113,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_61 = tmp3_27*x3;
     auto tmp3_62 = tmp3_61*tmp1_23;
     auto tmp3_63 = tmp3_56 + tmp3_62 + tmp3_60;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_63))));
     auto tmp3_64 = s + tmp1_25 + tmp3_27;
     auto tmp3_65 = tmp3_64*x2;
     auto tmp1_31 = x2*s;
@@ -146,6 +148,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_89 = -tmp3_61 + tmp3_88;
     auto tmp3_90 = x2*tmp3_89;
     auto tmp3_91 = tmp3_86 + tmp3_90 + tmp3_72;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_91))));
     auto tmp3_92 = x3-1;
     auto tmp3_93 = tmp3_92*tmp3_87;
     auto tmp3_94 = tmp3_92*x3;
@@ -175,6 +178,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_118 = tmp1_25-s;
     auto tmp3_119 = x5*tmp3_87*tmp3_118*tmp3_117;
     auto tmp3_120 = tmp3_114 + tmp3_119 + tmp3_116;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_120))));
     auto tmp3_121 = tmp3_64*tmp3_23;
     auto tmp3_122 = -tmp1_31 + tmp3_57;
     auto tmp3_123 = tmp3_122*tmp3_46;
@@ -206,6 +210,7 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_149 = msq*tmp3_148;
     auto tmp3_150 = tmp3_61*tmp3_146;
     auto tmp3_151 = tmp3_149 + tmp3_150 + tmp3_129;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_151))));
     auto tmp3_152 = tmp3_27-2*tmp1_31;
     auto tmp3_153 = x4*tmp3_152;
     auto tmp3_154 = tmp3_153 + tmp1_27;
@@ -241,11 +246,6 @@ void sector_18_order_0_maximal_allowed_deformation_parameters
     auto tmp3_184 = tmp1_29*x1;
     auto tmp3_185 = tmp3_183 + tmp3_159-tmp3_121-tmp3_184;
     auto tmp3_186 = x5*tmp3_185;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_29))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_63))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_91))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_120))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_151))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_186))));
 }
 }
@@ -19,6 +19,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_21 = s + t;
     auto tmp1_1 = 2*x4;
     auto tmp1_2 = 2*x2;
     auto tmp1_3 = tmp1_1 + tmp1_2;
@@ -57,13 +58,13 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_18 = x0*s;
     auto tmp3_19 = -s + tmp3_18;
     auto tmp3_20 = tmp3_19*tmp3_17;
-    auto tmp3_21 = s + t;
     auto tmp3_22 = tmp3_21*x0;
     auto tmp3_23 = -tmp3_22 + tmp3_21;
     auto tmp3_24 = x1*tmp3_23;
     auto tmp3_25 = tmp3_20 + tmp3_24;
     auto tmp3_26 = x0*tmp3_25;
     auto tmp3_27 = tmp3_16 + tmp3_26;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
     auto tmp3_28 = tmp1_12 + 3;
     auto tmp3_29 = tmp3_28*x3;
     auto tmp3_30 = tmp3_28*x5;
@@ -124,6 +125,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp1_34 = tmp1_33*x4;
     auto tmp3_70 = tmp3_58 + tmp3_67-tmp1_34-tmp3_61;
     auto tmp3_71 = x1*tmp3_70;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_71))));
     auto tmp3_72 = tmp3_69-tmp3_68;
     auto tmp3_73 = x4*tmp3_72;
     auto tmp3_74 = x2*s;
@@ -161,6 +163,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_105 = tmp3_104 + tmp3_98;
     auto tmp3_106 = msq*tmp3_105;
     auto tmp3_107 = tmp3_106 + tmp3_83;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_107))));
     auto tmp3_108 = x3-1;
     auto tmp3_109 = tmp3_108*tmp3_17;
     auto tmp3_110 = SecDecInternalSqr(x3);
@@ -198,6 +201,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_141 = tmp3_136 + tmp3_137;
     auto tmp3_142 = tmp1_31*x3*tmp3_141;
     auto tmp3_143 = tmp3_133 + tmp3_142 + tmp3_140;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_143))));
     auto tmp3_144 = -tmp1_1-tmp1_13;
     auto tmp3_145 = tmp1_11*tmp3_144;
     auto tmp3_146 = -tmp3_49 + tmp3_145;
@@ -221,6 +225,7 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_164 = x1*tmp3_163;
     auto tmp3_165 = tmp3_81*tmp3_157;
     auto tmp3_166 = tmp3_160 + tmp3_165 + tmp3_164;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_166))));
     auto tmp3_167 = -x5*tmp1_24;
     auto tmp3_168 = -tmp3_116 + tmp3_167;
     auto tmp3_169 = x5*tmp3_168;
@@ -257,11 +262,6 @@ void sector_5_order_0_maximal_allowed_deformation_parameters
     auto tmp3_200 = tmp3_199-tmp3_135 + tmp3_198;
     auto tmp3_201 = x5*tmp3_200;
     auto tmp3_202 = tmp3_191 + tmp3_201 + tmp3_197;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_71))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_107))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_143))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_166))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_202))));
 }
 }
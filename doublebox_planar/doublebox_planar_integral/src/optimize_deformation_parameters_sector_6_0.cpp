@@ -19,6 +19,7 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_23 = s + t;
     auto tmp1_1 = SecDecInternalSqr(x0);
     auto tmp3_1 = tmp1_1-1;
     auto tmp1_2 = x5 + 1;
@@ -51,7 +52,6 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_20 = msq*tmp3_19;
     auto tmp3_21 = x3*s;
     auto tmp3_22 = tmp3_21*tmp3_4;
-    auto tmp3_23 = s + t;
     auto tmp1_11 = x0*x5;
     auto tmp1_12 = tmp3_23*tmp1_11;
     auto tmp1_13 = tmp3_23*x5;
@@ -60,6 +60,7 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_25 = tmp3_22 + tmp3_24;
     auto tmp3_26 = x0*tmp3_25;
     auto tmp3_27 = tmp3_20 + tmp3_26;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
     auto tmp3_28 = x5*s;
     auto tmp3_29 = s + tmp3_28 + tmp3_21;
     auto tmp1_15 = tmp3_29*x4;
@@ -118,6 +119,7 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_67 = tmp3_66*x2;
     auto tmp3_68 = tmp3_64 + tmp3_35-tmp1_15 + tmp3_67;
     auto tmp3_69 = x1*tmp3_68;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_69))));
     auto tmp3_70 = -tmp3_67 + tmp3_66;
     auto tmp3_71 = x2*tmp3_70;
     auto tmp3_72 = x2-1;
@@ -144,6 +146,7 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_93 = msq*tmp3_92;
     auto tmp3_94 = tmp3_21*tmp3_90;
     auto tmp3_95 = tmp3_93 + tmp3_94 + tmp3_75;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_95))));
     auto tmp3_96 = x3-1;
     auto tmp3_97 = tmp3_96*x3;
     auto tmp3_98 = tmp3_97*x0;
@@ -174,6 +177,7 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_123 = tmp3_21-s;
     auto tmp3_124 = tmp3_123*tmp3_122;
     auto tmp3_125 = tmp3_120 + tmp3_124;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_125))));
     auto tmp3_126 = tmp3_65-tmp3_21;
     auto tmp3_127 = x2*tmp3_126;
     auto tmp3_128 = -s + tmp1_18;
@@ -202,6 +206,7 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_151 = tmp3_150 + tmp3_149;
     auto tmp3_152 = msq*tmp3_151;
     auto tmp3_153 = tmp3_152 + tmp3_133;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_153))));
     auto tmp3_154 = x5-1;
     auto tmp3_155 = tmp1_11*tmp3_154;
     auto tmp3_156 = tmp3_154*x5;
@@ -233,11 +238,6 @@ void sector_6_order_0_maximal_allowed_deformation_parameters
     auto tmp3_182 = tmp3_181 + tmp3_179;
     auto tmp3_183 = x1*tmp3_182;
     auto tmp3_184 = tmp3_183 + tmp3_177;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_27))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_69))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_95))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_125))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_153))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_184))));
 }
 }
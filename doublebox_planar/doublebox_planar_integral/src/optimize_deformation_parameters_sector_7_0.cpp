@@ -19,6 +19,7 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_23 = s + t;
     auto tmp1_1 = SecDecInternalSqr(x0);
     auto tmp3_1 = tmp1_1-1;
     auto tmp1_2 = x5 + 1;
@@ -51,7 +52,6 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_20 = msq*tmp3_19;
     auto tmp3_21 = x4*s;
     auto tmp3_22 = tmp3_21*tmp3_4;
-    auto tmp3_23 = s + t;
     auto tmp1_11 = x0*x5;
     auto tmp1_12 = tmp3_23*tmp1_11;
     auto tmp1_13 = x5*tmp3_23;
@@ -60,6 +60,7 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_26 = tmp3_22 + tmp3_25;
     auto tmp3_27 = x0*tmp3_26;
     auto tmp3_28 = tmp3_20 + tmp3_27;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
     auto tmp3_29 = x5*s;
     auto tmp3_30 = s + tmp3_29 + tmp3_21;
     auto tmp1_14 = tmp3_30*x2;
@@ -115,6 +116,7 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_65 = tmp3_64*x3;
     auto tmp3_66 = tmp3_63 + tmp3_34-tmp1_14 + tmp3_65;
     auto tmp3_67 = x1*tmp3_66;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_67))));
     auto tmp3_68 = tmp3_8 + x3;
     auto tmp3_69 = tmp1_15-s;
     auto tmp3_70 = tmp3_69*tmp3_68;
@@ -143,6 +145,7 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_93 = msq*tmp3_92;
     auto tmp3_94 = tmp3_21*tmp3_90;
     auto tmp3_95 = tmp3_93 + tmp3_94 + tmp3_72;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_95))));
     auto tmp3_96 = -x3*tmp1_25;
     auto tmp3_97 = tmp3_96-tmp1_3-3*tmp3_73;
     auto tmp3_98 = x3*tmp3_97;
@@ -167,6 +170,7 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_117 = x1*tmp3_116;
     auto tmp3_118 = tmp3_21*tmp3_110;
     auto tmp3_119 = tmp3_113 + tmp3_118 + tmp3_117;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_119))));
     auto tmp3_120 = x4-1;
     auto tmp3_121 = tmp3_120*x4;
     auto tmp3_122 = tmp3_121*x0;
@@ -196,6 +200,7 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_146 = tmp3_21-s;
     auto tmp3_147 = tmp3_146*tmp3_145;
     auto tmp3_148 = tmp3_143 + tmp3_147;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_148))));
     auto tmp3_149 = x5-1;
     auto tmp3_150 = tmp3_149*tmp1_11;
     auto tmp3_151 = x2 + 1;
@@ -228,11 +233,6 @@ void sector_7_order_0_maximal_allowed_deformation_parameters
     auto tmp3_178 = tmp3_177 + tmp3_175;
     auto tmp3_179 = x1*tmp3_178;
     auto tmp3_180 = tmp3_179 + tmp3_174;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_67))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_95))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_119))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_148))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_180))));
 }
 }
@@ -19,6 +19,7 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
+    auto tmp3_23 = s + t;
     auto tmp1_1 = x3 + 1;
     auto tmp1_2 = SecDecInternalSqr(x0);
     auto tmp3_1 = tmp1_2-1;
@@ -53,13 +54,13 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     auto tmp3_20 = x0*s;
     auto tmp3_21 = -s + tmp3_20;
     auto tmp3_22 = tmp3_21*tmp3_19;
-    auto tmp3_23 = s + t;
     auto tmp3_24 = tmp3_23*x0;
     auto tmp3_25 = -tmp3_24 + tmp3_23;
     auto tmp3_26 = tmp3_25*tmp3_9;
     auto tmp3_27 = tmp3_22 + tmp3_26;
     auto tmp3_28 = x0*tmp3_27;
     auto tmp3_29 = tmp3_18 + tmp3_28;
+    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_29))));
     auto tmp3_30 = x0 + 1;
     auto tmp3_31 = tmp3_30*x5;
     auto tmp3_32 = tmp3_30*x3;
@@ -121,6 +122,7 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     auto tmp1_35 = tmp3_65*x2;
     auto tmp3_66 = tmp3_55 + tmp3_63-tmp1_31 + tmp1_35;
     auto tmp3_67 = x1*tmp3_66;
+    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_67))));
     auto tmp3_68 = -x5-tmp1_1;
     auto tmp1_36 = 1 + 3*x0;
     auto tmp3_69 = tmp1_36*tmp3_68;
@@ -158,6 +160,7 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     auto tmp3_101 = tmp3_57*x3;
     auto tmp3_102 = tmp3_101*tmp3_90;
     auto tmp3_103 = tmp3_93 + tmp3_102 + tmp3_100;
+    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_103))));
     auto tmp3_104 = x2*x3;
     auto tmp3_105 = x4*x3;
     auto tmp3_106 = tmp3_104 + tmp3_105;
@@ -195,6 +198,7 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     auto tmp3_138 = -tmp3_137 + tmp3_136;
     auto tmp3_139 = x3*tmp3_138;
     auto tmp3_140 = tmp3_129 + tmp3_134 + tmp3_139 + tmp3_131;
+    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_140))));
     auto tmp3_141 = x4-1;
     auto tmp3_142 = tmp3_141*tmp1_33;
     auto tmp3_143 = tmp3_142 + tmp1_31-tmp1_30;
@@ -226,6 +230,7 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     auto tmp3_169 = -tmp3_101 + tmp3_168;
     auto tmp3_170 = x4*tmp3_169;
     auto tmp3_171 = tmp3_167 + tmp3_170 + tmp3_148;
+    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_171))));
     auto tmp3_172 = x5-1;
     auto tmp3_173 = tmp3_172*tmp3_19;
     auto tmp3_174 = SecDecInternalSqr(x5);
@@ -259,11 +264,6 @@ void sector_8_order_0_maximal_allowed_deformation_parameters
     auto tmp3_202 = tmp3_19*tmp3_201;
     auto tmp3_203 = x1*x5*tmp3_200;
     auto tmp3_204 = tmp3_198 + tmp3_203 + tmp3_202;
-    SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_29))));
-    SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_67))));
-    SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_103))));
-    SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_140))));
-    SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_171))));
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_204))));
 }
 }
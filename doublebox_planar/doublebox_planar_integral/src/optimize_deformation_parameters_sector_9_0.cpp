@@ -19,48 +19,8 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     const auto s = real_parameters[0]; (void)s;
     const auto t = real_parameters[1]; (void)t;
     const auto msq = real_parameters[2]; (void)msq;
-    auto tmp1_1 = x0-1;
-    auto tmp1_2 = tmp1_1*x0;
-    auto tmp1_3 = tmp1_2*x1;
-    auto tmp1_4 = SecDecInternalSqr(x0);
-    auto tmp3_1 = tmp1_4-1;
-    auto tmp1_5 = tmp3_1*x0;
-    auto tmp3_2 = tmp1_3 + tmp1_5;
-    auto tmp1_6 = x4 + x2;
-    auto tmp3_3 = -tmp3_2*tmp1_6;
-    auto tmp1_7 = x3*x0;
-    auto tmp3_4 = -tmp3_1*tmp1_7;
-    auto tmp1_8 = tmp1_7*tmp1_1;
-    auto tmp1_9 = -tmp1_2-tmp1_8;
-    auto tmp3_5 = x1*tmp1_9;
-    auto tmp3_6 = tmp3_5-tmp1_5 + tmp3_4 + tmp3_3;
-    auto tmp3_7 = 2*x2;
-    auto tmp3_8 = tmp3_7 + x4;
-    auto tmp3_9 = 2*x3;
-    auto tmp1_10 = tmp3_9 + 3;
-    auto tmp1_11 = -tmp1_10-tmp3_8;
-    auto tmp3_10 = x4*tmp1_11;
-    auto tmp1_12 = -x2-tmp1_10;
-    auto tmp3_11 = x2*tmp1_12;
-    auto tmp3_12 = tmp3_10 + tmp3_11-1;
-    auto tmp3_13 = tmp1_2*tmp3_12;
-    auto tmp3_14 = -3*tmp1_2-tmp1_8;
-    auto tmp3_15 = x3*tmp3_14;
-    auto tmp3_16 = tmp3_15 + tmp3_13;
-    auto tmp3_17 = x5*tmp3_16;
-    auto tmp3_18 = 2*tmp3_6 + tmp3_17;
-    auto tmp3_19 = msq*tmp3_18;
     auto tmp3_20 = s + t;
-    auto tmp3_21 = tmp3_20*x0;
-    auto tmp3_22 = -tmp3_21 + tmp3_20;
-    auto tmp3_23 = tmp3_22*tmp1_7;
-    auto tmp3_24 = x4*x2;
-    auto tmp1_13 = x0*s;
-    auto tmp1_14 = -s + tmp1_13;
-    auto tmp3_25 = x0*tmp1_14*tmp3_24;
-    auto tmp3_26 = tmp3_23 + tmp3_25;
-    auto tmp3_27 = x5*tmp3_26;
-    auto tmp3_28 = tmp3_27 + tmp3_19;
+    auto tmp1_7 = x3*x0;
     auto tmp3_29 = x3 + 1;
     auto tmp3_30 = -x1*tmp3_29;
     auto tmp3_31 = tmp3_30-x0-tmp1_7;
@@ -76,6 +36,10 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_37 = x2*x1;
     auto tmp3_38 = -tmp3_34*tmp3_37;
     auto tmp3_39 = tmp3_38 + tmp3_36;
+    auto tmp3_7 = 2*x2;
+    auto tmp3_8 = tmp3_7 + x4;
+    auto tmp3_9 = 2*x3;
+    auto tmp1_10 = tmp3_9 + 3;
     auto tmp3_40 = tmp1_10*x1;
     auto tmp3_41 = tmp1_10-tmp3_40;
     auto tmp1_19 = x1-1;
@@ -87,18 +51,18 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_45 = tmp3_44 + 1;
     auto tmp1_22 = tmp3_45*x1;
     auto tmp3_46 = tmp3_43-tmp1_22 + tmp3_45;
-    auto tmp3_47 = x1*tmp3_46;
     auto tmp3_48 = x1*tmp3_41;
     auto tmp3_49 = -tmp1_19*tmp3_37;
     auto tmp3_50 = tmp3_48 + tmp3_49;
+    auto tmp3_47 = x1*tmp3_46;
     auto tmp3_51 = x2*tmp3_50;
     auto tmp3_52 = tmp3_51 + tmp3_47;
     auto tmp3_53 = x5*tmp3_52;
     auto tmp3_54 = 2*tmp3_39 + tmp3_53;
-    auto tmp3_55 = msq*tmp3_54;
     auto tmp3_56 = x3*s;
     auto tmp3_57 = tmp3_56 + s;
     auto tmp3_58 = x1*tmp3_57*tmp1_19;
+    auto tmp3_55 = msq*tmp3_54;
     auto tmp3_59 = x1*s;
     auto tmp3_60 = tmp3_59-s;
     auto tmp3_61 = tmp3_60*x1;
@@ -108,19 +72,87 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_63 = tmp1_23*tmp1_24;
     auto tmp3_64 = x4*tmp3_61;
     auto tmp3_65 = tmp3_55 + tmp3_63 + tmp3_64 + tmp3_58 + tmp3_62;
+    auto tmp1_26 = tmp3_9 + 1;
+    auto tmp3_170 = -tmp1_26-tmp3_8;
+    auto tmp3_171 = x4*tmp3_170;
+    auto tmp3_172 = -x3*tmp3_29;
+    auto tmp3_173 = -x2-tmp1_26;
+    auto tmp3_174 = x2*tmp3_173;
+    auto tmp3_175 = tmp3_171 + tmp3_172 + tmp3_174;
+    auto tmp1_1 = x0-1;
+    auto tmp3_160 = tmp1_1*tmp3_9;
+    auto tmp3_161 = 1 + 3*x0;
+    auto tmp3_162 = tmp3_40 + tmp3_160 + tmp3_161;
+    auto tmp3_163 = tmp1_1 + x1;
+    auto tmp3_164 = -x2*tmp3_163;
+    auto tmp3_165 = tmp3_164-tmp3_162;
+    auto tmp3_167 = -tmp3_163*tmp3_8;
+    auto tmp3_168 = tmp3_167-tmp3_162;
+    auto tmp3_178 = -x3*tmp1_1;
+    auto tmp3_179 = tmp3_178-tmp3_161;
+    auto tmp3_166 = x2*tmp3_165;
+    auto tmp3_169 = x4*tmp3_168;
+    auto tmp3_176 = x5*tmp3_175;
+    auto tmp3_177 = tmp1_22 + tmp1_16;
+    auto tmp3_180 = x3*tmp3_179;
+    auto tmp3_181 = 2*tmp3_176 + tmp3_169 + tmp3_166 + tmp3_180-tmp3_177;
     auto tmp3_66 = tmp3_9*tmp1_16;
     auto tmp3_67 = 3*tmp1_16;
     auto tmp3_68 = tmp3_66 + tmp3_40 + tmp3_67;
-    auto tmp3_69 = tmp3_66 + tmp1_16;
+    auto tmp3_182 = x5*tmp3_181;
     auto tmp3_70 = tmp1_16 + x1;
+    auto tmp3_78 = tmp3_70*x2;
+    auto tmp3_183 = tmp3_78 + tmp3_68;
+    auto tmp3_184 = x2*tmp3_183;
     auto tmp1_25 = tmp3_70*tmp3_7;
-    auto tmp1_26 = tmp3_9 + 1;
+    auto tmp3_142 = tmp3_68 + tmp1_25;
+    auto tmp3_185 = x4*tmp3_70;
+    auto tmp3_186 = tmp3_185 + tmp3_142;
+    auto tmp3_187 = x4*tmp3_186;
+    auto tmp3_188 = tmp3_67 + tmp1_18;
+    auto tmp3_189 = x3*tmp3_188;
+    auto tmp3_190 = tmp3_182 + tmp3_187 + tmp3_184 + tmp3_189 + tmp3_177;
+    auto tmp1_4 = SecDecInternalSqr(x0);
+    auto tmp3_1 = tmp1_4-1;
+    auto tmp1_2 = tmp1_1*x0;
+    auto tmp1_3 = tmp1_2*x1;
+    auto tmp1_5 = tmp3_1*x0;
+    auto tmp3_2 = tmp1_3 + tmp1_5;
+    auto tmp1_6 = x4 + x2;
+    auto tmp3_3 = -tmp3_2*tmp1_6;
+    auto tmp3_4 = -tmp3_1*tmp1_7;
+    auto tmp1_8 = tmp1_7*tmp1_1;
+    auto tmp1_9 = -tmp1_2-tmp1_8;
+    auto tmp3_5 = x1*tmp1_9;
+    auto tmp3_6 = tmp3_5-tmp1_5 + tmp3_4 + tmp3_3;
+    auto tmp3_101 = tmp1_18-tmp1_16;
+    auto tmp3_102 = tmp3_101*x3;
+    auto tmp3_103 = x3-1;
+    auto tmp3_104 = x1*x3;
+    auto tmp3_105 = tmp3_103*tmp3_104;
+    auto tmp3_106 = tmp3_102 + tmp3_105;
+    auto tmp1_40 = 2*x4;
+    auto tmp1_41 = -tmp1_40-tmp3_7;
+    auto tmp3_107 = tmp3_106*tmp1_41;
+    auto tmp3_108 = -tmp1_6*tmp3_103*tmp3_9;
+    auto tmp1_29 = tmp3_9-1;
+    auto tmp3_109 = -x3*tmp1_29;
+    auto tmp3_110 = 1 + tmp3_109;
+    auto tmp3_111 = x3*tmp3_110;
+    auto tmp3_112 = tmp3_111 + tmp3_108;
+    auto tmp3_69 = tmp3_66 + tmp1_16;
+    auto tmp3_114 = -x3*tmp3_69;
+    auto tmp3_115 = tmp3_67 + tmp3_114;
+    auto tmp3_113 = x5*tmp3_112;
+    auto tmp3_116 = x3*tmp3_115;
+    auto tmp3_117 = -x3*tmp1_26;
+    auto tmp3_118 = 3 + tmp3_117;
+    auto tmp3_119 = tmp3_118*tmp3_104;
+    auto tmp3_120 = tmp3_113 + tmp3_116 + tmp3_119 + tmp3_107;
     auto tmp1_27 = tmp1_26*x1;
     auto tmp3_71 = tmp1_27 + tmp1_25 + tmp3_69;
     auto tmp1_28 = -x2*tmp3_71;
     auto tmp3_72 = tmp1_28 + tmp3_68;
-    auto tmp3_73 = x2*tmp3_72;
-    auto tmp1_29 = tmp3_9-1;
     auto tmp1_30 = tmp1_29 + tmp3_7;
     auto tmp1_31 = -x2*tmp1_30;
     auto tmp3_74 = tmp1_31 + tmp1_26;
@@ -129,10 +161,10 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp1_33 = x2-1;
     auto tmp1_34 = -tmp1_33*tmp1_32;
     auto tmp3_76 = tmp3_75 + tmp1_34;
-    auto tmp3_77 = x5*tmp3_76;
-    auto tmp3_78 = tmp3_70*x2;
     auto tmp1_35 = -tmp3_78 + tmp3_70;
     auto tmp3_79 = tmp1_35*tmp1_32;
+    auto tmp3_73 = x2*tmp3_72;
+    auto tmp3_77 = x5*tmp3_76;
     auto tmp3_80 = tmp3_77 + tmp3_73 + tmp3_79;
     auto tmp3_81 = x5*tmp3_80;
     auto tmp3_82 = x1 + 2*tmp1_16;
@@ -144,7 +176,7 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp3_88 = tmp1_33*x2;
     auto tmp3_89 = -tmp3_87*tmp3_88;
     auto tmp3_90 = tmp3_89 + tmp3_81;
-    auto tmp3_91 = msq*tmp3_90;
+    auto tmp1_13 = x0*s;
     auto tmp3_92 = tmp1_13 + tmp3_59;
     auto tmp3_93 = tmp3_92 + s;
     auto tmp1_36 = tmp3_93*x2;
@@ -152,120 +184,88 @@ void sector_9_order_0_maximal_allowed_deformation_parameters
     auto tmp1_38 = tmp1_37-s;
     auto tmp1_39 = x5*tmp1_38;
     auto tmp3_94 = tmp1_39 + tmp1_36-tmp3_93;
+    auto tmp3_24 = x4*x2;
     auto tmp3_95 = tmp3_24*tmp3_94;
     auto tmp3_96 = x2*tmp1_38;
     auto tmp3_97 = tmp3_96 + tmp3_95;
+    auto tmp3_91 = msq*tmp3_90;
     auto tmp3_98 = x5*tmp3_97;
     auto tmp3_99 = tmp3_59*tmp3_88;
     auto tmp3_100 = tmp3_91 + tmp3_99 + tmp3_98;
-    auto tmp3_101 = tmp1_18-tmp1_16;
-    auto tmp3_102 = tmp3_101*x3;
-    auto tmp3_103 = x3-1;
-    auto tmp3_104 = x1*x3;
-    auto tmp3_105 = tmp3_103*tmp3_104;
-    auto tmp3_106 = tmp3_102 + tmp3_105;
-    auto tmp1_40 = 2*x4;
-    auto tmp1_41 = -tmp1_40-tmp3_7;
-    auto tmp3_107 = tmp3_106*tmp1_41;
-    auto tmp3_108 = -tmp1_6*tmp3_103*tmp3_9;
-    auto tmp3_109 = -x3*tmp1_29;
-    auto tmp3_110 = 1 + tmp3_109;
-    auto tmp3_111 = x3*tmp3_110;
-    auto tmp3_112 = tmp3_111 + tmp3_108;
-    auto tmp3_113 = x5*tmp3_112;
-    auto tmp3_114 = -x3*tmp3_69;
-    auto tmp3_115 = tmp3_67 + tmp3_114;
-    auto tmp3_116 = x3*tmp3_115;
-    auto tmp3_117 = -x3*tmp1_26;
-    auto tmp3_118 = 3 + tmp3_117;
-    auto tmp3_119 = tmp3_118*tmp3_104;
-    auto tmp3_120 = tmp3_113 + tmp3_116 + tmp3_119 + tmp3_107;
-    auto tmp3_121 = x5*tmp3_120;
     auto tmp3_122 = -tmp3_101*tmp3_9;
     auto tmp3_123 = tmp3_122-tmp3_105;
-    auto tmp3_124 = x1*tmp3_123;
     auto tmp3_125 = -x3*tmp3_86*tmp3_103;
+    auto tmp3_121 = x5*tmp3_120;
+    auto tmp3_124 = x1*tmp3_123;
     auto tmp3_126 = tmp3_121 + tmp3_125 + tmp3_124;
-    auto tmp3_127 = msq*tmp3_126;
     auto tmp3_128 = -s + tmp3_56;
     auto tmp3_129 = tmp3_128*tmp3_104;
+    auto tmp3_127 = msq*tmp3_126;
+    auto tmp3_21 = tmp3_20*x0;
     auto tmp3_130 = tmp3_20*tmp1_7;
     auto tmp3_131 = tmp3_21-tmp3_130;
     auto tmp3_132 = x5*x3*tmp3_131;
     auto tmp3_133 = tmp3_127 + tmp3_129 + tmp3_132;
+    auto tmp3_148 = -tmp1_40-tmp1_30;
+    auto tmp3_149 = x4*tmp3_148;
+    auto tmp3_150 = tmp3_149 + tmp3_7 + tmp1_26;
+    auto tmp3_192 = tmp3_130-tmp1_37;
+    auto tmp3_193 = -s + tmp3_92;
+    auto tmp3_194 = x2*tmp3_193;
+    auto tmp3_195 = tmp3_59 + tmp3_194;
+    auto tmp3_196 = x4*tmp3_195;
+    auto tmp3_197 = s*tmp3_7*tmp1_24;
+    auto tmp3_198 = tmp3_197 + tmp3_196-tmp3_192;
     auto tmp3_134 = tmp1_36 + tmp3_59;
+    auto tmp3_191 = msq*tmp3_190;
+    auto tmp3_199 = x5*tmp3_198;
     auto tmp3_135 = tmp3_134*x4;
+    auto tmp3_200 = tmp3_191 + tmp3_199-tmp3_135 + tmp3_192;
     auto tmp3_136 = tmp3_135-tmp3_134;
     auto tmp3_137 = x4*tmp3_136;
     auto tmp3_138 = x4-1;
     auto tmp3_139 = tmp1_24*tmp1_37*tmp3_138;
     auto tmp3_140 = tmp3_137 + tmp3_139;
-    auto tmp3_141 = x5*tmp3_140;
-    auto tmp3_142 = tmp3_68 + tmp1_25;
     auto tmp3_143 = -tmp3_70*tmp1_40;
     auto tmp3_144 = tmp3_143-tmp3_71;
     auto tmp3_145 = x4*tmp3_144;
     auto tmp3_146 = tmp3_145 + tmp3_142;
-    auto tmp3_147 = x4*tmp3_146;
-    auto tmp3_148 = -tmp1_40-tmp1_30;
-    auto tmp3_149 = x4*tmp3_148;
-    auto tmp3_150 = tmp3_149 + tmp3_7 + tmp1_26;
     auto tmp3_151 = tmp3_150*tmp1_24;
+    auto tmp3_147 = x4*tmp3_146;
     auto tmp3_152 = tmp3_147 + tmp3_151;
     auto tmp3_153 = x5*tmp3_152;
     auto tmp3_154 = tmp3_138*x4;
     auto tmp3_155 = -tmp3_87*tmp3_154;
     auto tmp3_156 = tmp3_155 + tmp3_153;
-    auto tmp3_157 = msq*tmp3_156;
     auto tmp3_158 = tmp3_59*tmp3_154;
+    auto tmp3_141 = x5*tmp3_140;
+    auto tmp3_157 = msq*tmp3_156;
     auto tmp3_159 = tmp3_157 + tmp3_158 + tmp3_141;
-    auto tmp3_160 = tmp1_1*tmp3_9;
-    auto tmp3_161 = 1 + 3*x0;
-    auto tmp3_162 = tmp3_40 + tmp3_160 + tmp3_161;
-    auto tmp3_163 = tmp1_1 + x1;
-    auto tmp3_164 = -x2*tmp3_163;
-    auto tmp3_165 = tmp3_164-tmp3_162;
-    auto tmp3_166 = x2*tmp3_165;
-    auto tmp3_167 = -tmp3_163*tmp3_8;
-    auto tmp3_168 = tmp3_167-tmp3_162;
-    auto tmp3_169 = x4*tmp3_168;
-    auto tmp3_170 = -tmp1_26-tmp3_8;
-    auto tmp3_171 = x4*tmp3_170;
-    auto tmp3_172 = -x3*tmp3_29;
-    auto tmp3_173 = -x2-tmp1_26;
-    auto tmp3_174 = x2*tmp3_173;
-    auto tmp3_175 = tmp3_171 + tmp3_172 + tmp3_174;
-    auto tmp3_176 = x5*tmp3_175;
-    auto tmp3_177 = tmp1_22 + tmp1_16;
-    auto tmp3_178 = -x3*tmp1_1;
-    auto tmp3_179 = tmp3_178-tmp3_161;
-    auto tmp3_180 = x3*tmp3_179;
-    auto tmp3_181 = 2*tmp3_176 + tmp3_169 + tmp3_166 + tmp3_180-tmp3_177;
-    auto tmp3_182 = x5*tmp3_181;
-    auto tmp3_183 = tmp3_78 + tmp3_68;
-    auto tmp3_184 = x2*tmp3_183;
-    auto tmp3_185 = x4*tmp3_70;
-    auto tmp3_186 = tmp3_185 + tmp3_142;
-    auto tmp3_187 = x4*tmp3_186;
-    auto tmp3_188 = tmp3_67 + tmp1_18;
-    auto tmp3_189 = x3*tmp3_188;
-    auto tmp3_190 = tmp3_182 + tmp3_187 + tmp3_184 + tmp3_189 + tmp3_177;
-    auto tmp3_191 = msq*tmp3_190;
-    auto tmp3_192 = tmp3_130-tmp1_37;
-    auto tmp3_193 = -s + tmp3_92;
-    auto tmp3_194 = x2*tmp3_193;
-    auto tmp3_195 = tmp3_59 + tmp3_194;
-    auto tmp3_196 = x4*tmp3_195;
-    auto tmp3_197 = s*tmp3_7*tmp1_24;
-    auto tmp3_198 = tmp3_197 + tmp3_196-tmp3_192;
-    auto tmp3_199 = x5*tmp3_198;
-    auto tmp3_200 = tmp3_191 + tmp3_199-tmp3_135 + tmp3_192;
-    auto tmp3_201 = x5*tmp3_200;
+    auto tmp1_11 = -tmp1_10-tmp3_8;
+    auto tmp3_10 = x4*tmp1_11;
+    auto tmp1_12 = -x2-tmp1_10;
+    auto tmp3_11 = x2*tmp1_12;
+    auto tmp3_12 = tmp3_10 + tmp3_11-1;
+    auto tmp3_13 = tmp1_2*tmp3_12;
+    auto tmp3_14 = -3*tmp1_2-tmp1_8;
+    auto tmp3_15 = x3*tmp3_14;
+    auto tmp3_16 = tmp3_15 + tmp3_13;
+    auto tmp3_17 = x5*tmp3_16;
+    auto tmp3_18 = 2*tmp3_6 + tmp3_17;
+    auto tmp3_22 = -tmp3_21 + tmp3_20;
+    auto tmp3_23 = tmp3_22*tmp1_7;
+    auto tmp1_14 = -s + tmp1_13;
+    auto tmp3_25 = x0*tmp1_14*tmp3_24;
+    auto tmp3_26 = tmp3_23 + tmp3_25;
+    auto tmp3_19 = msq*tmp3_18;
+    auto tmp3_27 = x5*tmp3_26;
+    auto tmp3_28 = tmp3_27 + tmp3_19;
     SecDecInternalOutputDeformationParameters(0, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_28))));
     SecDecInternalOutputDeformationParameters(1, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_65))));
     SecDecInternalOutputDeformationParameters(2, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_100))));
     SecDecInternalOutputDeformationParameters(3, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_133))));
     SecDecInternalOutputDeformationParameters(4, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_159))));
+    auto tmp3_201 = x5*tmp3_200;
     SecDecInternalOutputDeformationParameters(5, SecDecInternalDenominator(SecDecInternalAbs(SecDecInternalRealPart(tmp3_201))));
 }
 }